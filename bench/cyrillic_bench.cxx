@@ -0,0 +1,229 @@
+#include <son8/cyrillic.hxx>
+// std headers
+#include <chrono> // steady_clock
+#include <cstdio> // fopen, fprintf, printf
+#include <cstdlib> // atof, EXIT_*
+#include <cstring> // strcmp
+#include <fstream> // ifstream
+#include <random> // mt19937
+#include <string> // string, getline
+#include <vector> // vector
+
+namespace cyr = son8::cyrillic;
+
+namespace {
+    // corpora
+    struct Corpus {
+        char const *name;
+        cyr::Language language;
+        cyr::Validate validate;
+        cyr::StringWord words; // encode input
+        cyr::StringByte bytes; // decode input, encoded words or raw bytes when words are invalid
+        cyr::StringByte utf8;  // words as utf-8, string_word input
+    };
+    // -- raw mt19937 output only, distributions differ between standard libraries
+    class Random {
+        std::mt19937 engine_;
+    public:
+        explicit Random( unsigned seed ) : engine_{ seed } { }
+        auto below( unsigned bound ) -> unsigned { return engine_( ) % bound; }
+        template< typename Char >
+        auto pick( std::basic_string_view< Char > pool ) -> Char { return pool[below( static_cast< unsigned >( pool.size( ) ) )]; }
+    };
+    constexpr std::u16string_view Pool_Russian_{ u"АБВГДЕЁЖЗИЙКЛМНОПРСТУФХЦЧШЩЪЫЬЭЮЯабвгдеёжзийклмнопрстуфхцчшщъыьэюя" };
+    constexpr std::u16string_view Pool_Ukrainian_{ u"АБВГҐДЕЄЖЗИІЇЙКЛМНОПРСТУФХЦЧШЩЬЮЯабвгґдеєжзиіїйклмнопрстуфхцчшщьюя" };
+    constexpr std::u16string_view Pool_Mixed_{ u"ЄІЇҐєіїґЁЪЫЭёъыэ" }; // jx form under russian for first half
+    constexpr std::u16string_view Pool_Ascii_{ u"abcdefghijklmnopqrstuvwxyz ABCDEFGHIJKLMNOPQRSTUVWXYZ 0123456789 .,:;!?()" };
+    auto corpus_words( Random &random, std::u16string_view pool, cyr::Size size ) -> cyr::StringWord {
+        cyr::StringWord words;
+        words.reserve( size );
+        for ( cyr::Size i = 0; i < size; ++i ) words.push_back( random.pick( pool ) );
+        return words;
+    }
+    auto corpus_make( char const *name, cyr::Language language, cyr::Validate validate, cyr::StringWord words ) -> Corpus {
+        Corpus corpus{ name, language, validate, std::move( words ), { }, { } };
+        cyr::string_byte( corpus.utf8, corpus.words );
+        cyr::this_thread::state( language );
+        cyr::this_thread::state( validate );
+        cyr::encode( corpus.bytes, corpus.words );
+        return corpus;
+    }
+    auto corpora( cyr::Size size ) -> std::vector< Corpus > {
+        using cyr::Language;
+        using cyr::Validate;
+        Random random{ static_cast< unsigned >( size ) };
+        std::vector< Corpus > all;
+        all.push_back( corpus_make( "russian", Language::Russian, Validate::None, corpus_words( random, Pool_Russian_, size ) ) );
+        all.push_back( corpus_make( "ukrainian", Language::Ukrainian, Validate::None, corpus_words( random, Pool_Ukrainian_, size ) ) );
+        all.push_back( corpus_make( "jx_mixed", Language::Russian, Validate::None, corpus_words( random, Pool_Mixed_, size ) ) );
+        // -- mostly ascii, one cyrillic letter in sixteen
+        cyr::StringWord ascii;
+        for ( cyr::Size i = 0; i < size; ++i ) ascii.push_back( random.below( 16 ) ? random.pick( Pool_Ascii_ ) : random.pick( Pool_Russian_ ) );
+        all.push_back( corpus_make( "mostly_ascii", Language::Russian, Validate::AppendAll, std::move( ascii ) ) );
+        // -- random units and bytes, surrogates replaced so utf-8 form exists, fails on first invalid unit
+        cyr::StringWord invalid;
+        for ( cyr::Size i = 0; i < size; ++i ) {
+            auto word = static_cast< char16_t >( random.below( 0x10000u ) );
+            invalid.push_back( ( 0xD800u <= word && word < 0xE000u ) ? u'?' : word );
+        }
+        auto corpus = corpus_make( "random_invalid", Language::Russian, Validate::None, std::move( invalid ) );
+        corpus.bytes.clear( );
+        for ( cyr::Size i = 0; i < size; ++i ) corpus.bytes.push_back( static_cast< char >( random.below( 256 ) ) );
+        all.push_back( std::move( corpus ) );
+        return all;
+    }
+    // measurement
+    struct Sample {
+        std::string corpus;
+        cyr::Size size;
+        std::string api;
+        double mbps;
+        double nspc;
+        bool failed;
+    };
+    // -- calls repeated until minimal time passes, best of rounds reported
+    template< typename Call >
+    auto measure( Call call, double seconds ) -> double {
+        using Clock = std::chrono::steady_clock;
+        double best = 0.0;
+        for ( int round = 0; round < 3; ++round ) {
+            cyr::Size calls = 0;
+            auto const start = Clock::now( );
+            std::chrono::duration< double > elapsed{ };
+            do {
+                call( );
+                ++calls;
+                elapsed = Clock::now( ) - start;
+            } while ( elapsed.count( ) < seconds );
+            auto const nspc = elapsed.count( ) * 1e9 / static_cast< double >( calls );
+            if ( best == 0.0 || nspc < best ) best = nspc;
+        }
+        return best;
+    }
+    void bench( std::vector< Sample > &samples, Corpus const &corpus, double seconds ) {
+        cyr::this_thread::state( corpus.language );
+        cyr::this_thread::state( corpus.validate );
+        auto const size = corpus.words.size( );
+        auto add = [&]( char const *api, cyr::Size bytes, bool failed, auto call ) {
+            auto const nspc = measure( call, seconds );
+            samples.push_back( Sample{ corpus.name, size, api, static_cast< double >( bytes ) * 1e3 / nspc, nspc, failed } );
+        };
+        cyr::StringWordView const words{ corpus.words };
+        cyr::StringByteView const bytes{ corpus.bytes };
+        auto const wordBytes = words.size( ) * sizeof( char16_t );
+        // -- encode shapes
+        cyr::Error code{ };
+        cyr::StringByte encoded;
+        bool const encodeFailed = cyr::encode( encoded, words ) != cyr::Error::None;
+        add( "encode_return", wordBytes, encodeFailed, [&] { code = cyr::encode( encoded, words ); } );
+        add( "encode_output", wordBytes, encodeFailed, [&] { auto ret = cyr::encode( words, code ); } );
+        add( "encode_thread", wordBytes, encodeFailed, [&] { auto ret = cyr::encode( words ); } );
+        add( "encoded_throw", wordBytes, encodeFailed, [&] {
+            try { cyr::Encoded ret{ words }; } catch ( cyr::Exception const & ) { }
+        } );
+        // -- decode shapes
+        cyr::StringWord decoded;
+        bool const decodeFailed = cyr::decode( decoded, bytes ) != cyr::Error::None;
+        add( "decode_return", bytes.size( ), decodeFailed, [&] { code = cyr::decode( decoded, bytes ); } );
+        add( "decode_output", bytes.size( ), decodeFailed, [&] { auto ret = cyr::decode( bytes, code ); } );
+        add( "decode_thread", bytes.size( ), decodeFailed, [&] { auto ret = cyr::decode( bytes ); } );
+        add( "decoded_throw", bytes.size( ), decodeFailed, [&] {
+            try { cyr::Decoded ret{ bytes }; } catch ( cyr::Exception const & ) { }
+        } );
+        // -- convert
+        add( "string_byte", wordBytes, false, [&] { auto ret = cyr::string_byte( words ); } );
+        add( "string_word", corpus.utf8.size( ), false, [&] { auto ret = cyr::string_word( corpus.utf8 ); } );
+    }
+    // report
+    auto sample_key( Sample const &sample ) -> std::string {
+        return sample.corpus + '/' + std::to_string( sample.size ) + '/' + sample.api;
+    }
+    auto json_write( char const *path, std::vector< Sample > const &samples ) -> bool {
+        auto *file = std::fopen( path, "w" );
+        if ( file == nullptr ) return false;
+        std::fprintf( file, "{\n  \"results\": [\n" );
+        for ( cyr::Size i = 0; i < samples.size( ); ++i ) {
+            auto const &s = samples[i];
+            // -- one result per line, baseline reader relies on it
+            std::fprintf( file, "    { \"corpus\": \"%s\", \"size\": %zu, \"api\": \"%s\", \"mb_per_s\": %.3f, \"ns_per_call\": %.3f, \"failed\": %s }%s\n"
+                , s.corpus.c_str( ), s.size, s.api.c_str( ), s.mbps, s.nspc, s.failed ? "true" : "false", i + 1 < samples.size( ) ? "," : "" );
+        }
+        std::fprintf( file, "  ]\n}\n" );
+        return std::fclose( file ) == 0;
+    }
+    auto json_field( std::string const &line, char const *name ) -> std::string {
+        auto const key = std::string{ "\"" } + name + "\": ";
+        auto from = line.find( key );
+        if ( from == std::string::npos ) return { };
+        from += key.size( );
+        if ( line[from] == '"' ) return line.substr( from + 1, line.find( '"', from + 1 ) - from - 1 );
+        return line.substr( from, line.find_first_of( ",}", from ) - from );
+    }
+    // -- reads json written by this tool, returns number of regressed samples
+    auto baseline_compare( char const *path, std::vector< Sample > const &samples, double threshold ) -> int {
+        std::ifstream file{ path };
+        if ( not file ) {
+            std::fprintf( stderr, "cyrillic_bench: cannot read baseline %s\n", path );
+            return -1;
+        }
+        int regressed = 0;
+        std::string line;
+        while ( std::getline( file, line ) ) {
+            auto const corpus = json_field( line, "corpus" );
+            if ( corpus.empty( ) ) continue;
+            auto const key = corpus + '/' + json_field( line, "size" ) + '/' + json_field( line, "api" );
+            auto const base = std::atof( json_field( line, "mb_per_s" ).c_str( ) );
+            for ( auto const &sample : samples ) {
+                if ( sample_key( sample ) != key ) continue;
+                if ( sample.mbps < base * ( 1.0 - threshold / 100.0 ) ) {
+                    std::printf( "REGRESSED %-40s %10.1f -> %10.1f MB/s\n", key.c_str( ), base, sample.mbps );
+                    ++regressed;
+                }
+            }
+        }
+        return regressed;
+    }
+    void usage( ) {
+        std::printf( "usage: cyrillic_bench [--quick] [--json FILE] [--baseline FILE] [--threshold PERCENT]\n"
+                     "  --quick      smaller sizes and shorter rounds\n"
+                     "  --json       write results to FILE\n"
+                     "  --baseline   compare with results previously written by --json\n"
+                     "  --threshold  allowed throughput drop against baseline, default 10\n" );
+    }
+} // namespace
+
+int main( int argc, char **argv ) {
+    bool quick = false;
+    char const *json = nullptr;
+    char const *baseline = nullptr;
+    double threshold = 10.0;
+    for ( int i = 1; i < argc; ++i ) {
+        auto const arg = [&]( char const *name ) { return std::strcmp( argv[i], name ) == 0; };
+        if/*_*/ ( arg( "--quick" ) ) quick = true;
+        else if ( arg( "--json" ) && i + 1 < argc ) json = argv[++i];
+        else if ( arg( "--baseline" ) && i + 1 < argc ) baseline = argv[++i];
+        else if ( arg( "--threshold" ) && i + 1 < argc ) threshold = std::atof( argv[++i] );
+        else return usage( ), EXIT_FAILURE;
+    }
+    std::vector< cyr::Size > const sizes = quick
+        ? std::vector< cyr::Size >{ 64, 4096 }
+        : std::vector< cyr::Size >{ 64, 4096, 1u << 20 };
+    double const seconds = quick ? 0.005 : 0.05;
+    std::vector< Sample > samples;
+    for ( auto size : sizes ) for ( auto const &corpus : corpora( size ) ) bench( samples, corpus, seconds );
+    std::printf( "%-16s %8s %-14s %12s %12s\n", "corpus", "size", "api", "MB/s", "ns/call" );
+    for ( auto const &s : samples ) {
+        std::printf( "%-16s %8zu %-14s %12.1f %12.1f%s\n", s.corpus.c_str( ), s.size, s.api.c_str( ), s.mbps, s.nspc, s.failed ? " (fails)" : "" );
+    }
+    if ( json && not json_write( json, samples ) ) {
+        std::fprintf( stderr, "cyrillic_bench: cannot write %s\n", json );
+        return EXIT_FAILURE;
+    }
+    if ( baseline ) {
+        auto const regressed = baseline_compare( baseline, samples, threshold );
+        if ( regressed != 0 ) return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
+
+// Ⓒ 2026 Oleg'Ease'Kharchuk ᦒ
@@ -2,15 +2,29 @@
 #define SON8_CYRILLIC_HXX
 
 #include <son8/cyrillic/alias.hxx>
+#include <son8/cyrillic/cache.hxx>
+#include <son8/cyrillic/codec.hxx>
+#include <son8/cyrillic/column.hxx>
 #include <son8/cyrillic/convert.hxx>
 #include <son8/cyrillic/decode.hxx>
 #include <son8/cyrillic/decoded.hxx>
+#include <son8/cyrillic/decoder.hxx>
+#include <son8/cyrillic/detect.hxx>
 #include <son8/cyrillic/encode.hxx>
 #include <son8/cyrillic/encoded.hxx>
+#include <son8/cyrillic/encoder.hxx>
 #include <son8/cyrillic/error.hxx>
 #include <son8/cyrillic/exception.hxx>
+#include <son8/cyrillic/fixed.hxx>
+#include <son8/cyrillic/parallel.hxx>
+#include <son8/cyrillic/profile.hxx>
+#include <son8/cyrillic/reencode.hxx>
+#include <son8/cyrillic/result.hxx>
+#include <son8/cyrillic/search.hxx>
 #include <son8/cyrillic/state.hxx>
+#include <son8/cyrillic/stats.hxx>
 #include <son8/cyrillic/validate.hxx>
+#include <son8/cyrillic/view.hxx>
 
 #endif//SON8_CYRILLIC_HXX
 
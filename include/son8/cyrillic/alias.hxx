@@ -3,6 +3,7 @@
 
 #include <cstddef> // size_t
 #include <cstdint> // u?int*
+#include <memory_resource>
 #include <string>
 #include <string_view>
 
@@ -22,6 +23,10 @@ namespace son8::cyrillic {
     using StringWord = std::u16string;
     using StringByteView = std::string_view;
     using StringWordView = std::u16string_view;
+    // allocator-aware string aliases
+    using StringBytePmr = std::pmr::string;
+    using StringWordPmr = std::pmr::u16string;
+    using MemoryResource = std::pmr::memory_resource;
 
 } // namespace
 
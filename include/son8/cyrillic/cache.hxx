@@ -0,0 +1,46 @@
+#ifndef SON8_CYRILLIC_CACHE_HXX
+#define SON8_CYRILLIC_CACHE_HXX
+
+#include <son8/cyrillic/alias.hxx>
+#include <son8/cyrillic/codec.hxx>
+#include <son8/cyrillic/decoded.hxx>
+#include <son8/cyrillic/encoded.hxx>
+#include <son8/cyrillic/error.hxx>
+// std headers
+#include <memory>
+
+namespace son8::cyrillic {
+
+    // bounded memo of transliteration results, keyed by input, language and validate
+    // -- shared between threads, entries are split over shards with own lock and clock eviction
+    class Cache final {
+        struct Shard;
+        std::unique_ptr< Shard[] > shards_;
+        unsigned count_;
+    public:
+        // public aliases, results stay valid after eviction
+        using EncodedPtr = std::shared_ptr< Encoded const >;
+        using DecodedPtr = std::shared_ptr< Decoded const >;
+        // constructors
+        explicit Cache( Size capacity, unsigned shards = 16 ); // capacity is total entries, at least one per shard
+       ~Cache( );
+        Cache( Cache const & ) = delete;
+        Cache &operator=( Cache const & ) = delete;
+        // lookups with settings of this thread or of codec, failed result is null and never cached
+        [[nodiscard]] auto encode( Encoded::In in, Error &code ) -> EncodedPtr;
+        [[nodiscard]] auto encode( Codec const &codec, Encoded::In in, Error &code ) -> EncodedPtr;
+        [[nodiscard]] auto decode( Decoded::In in, Error &code ) -> DecodedPtr;
+        [[nodiscard]] auto decode( Codec const &codec, Decoded::In in, Error &code ) -> DecodedPtr;
+        // counters
+        [[nodiscard]] auto hits( ) const noexcept -> Size;
+        [[nodiscard]] auto misses( ) const noexcept -> Size;
+        [[nodiscard]] auto size( ) const noexcept -> Size; // entries held
+        // modifiers
+        void clear( ); // drops entries, counters are kept
+    };
+
+} // namespace
+
+#endif//SON8_CYRILLIC_CACHE_HXX
+
+// Ⓒ 2026 Oleg'Ease'Kharchuk ᦒ
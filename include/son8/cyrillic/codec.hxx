@@ -0,0 +1,51 @@
+#ifndef SON8_CYRILLIC_CODEC_HXX
+#define SON8_CYRILLIC_CODEC_HXX
+
+#include <son8/cyrillic/alias.hxx>
+#include <son8/cyrillic/error.hxx>
+#include <son8/cyrillic/profile.hxx>
+#include <son8/cyrillic/result.hxx>
+#include <son8/cyrillic/state.hxx>
+
+namespace son8::cyrillic {
+
+    // settings captured once, several codecs may be used on one thread without touching thread state
+    class Codec final {
+        Language language_;
+        ValidateProfile profile_;
+    public:
+        // constructors
+        Codec( ) noexcept; // captures language and validate of this thread
+        Codec( Language language, Validate validate ) noexcept;
+        Codec( Language language, ValidateProfile const &profile ) noexcept; // profile copied
+        // getters
+        auto language( ) const noexcept -> Language;
+        auto validate( ) const noexcept -> Validate;
+        auto profile( ) const noexcept -> ValidateProfile const &;
+        // encode, same shapes as free functions
+        auto encode( StringByte &out, StringWordView in ) const -> Error;
+        auto encode( StringByte &out, StringByteView in ) const -> Error; // utf-8 input
+        auto encode( char *data, Size size, StringWordView in ) const -> Result;
+        auto encode( char *data, Size size, StringByteView in ) const -> Result;
+        auto encode_append( StringByte &out, StringWordView in ) const -> Result;
+        auto encode_append( StringByte &out, StringByteView in ) const -> Result;
+        [[nodiscard]] auto encoded_size( StringWordView in ) const -> Result;
+        [[nodiscard]] auto encoded_size( StringByteView in ) const -> Result;
+        [[nodiscard]] auto can_encode( StringWordView in ) const noexcept -> bool;
+        [[nodiscard]] auto can_encode( StringByteView in ) const noexcept -> bool;
+        // decode, validate is not used
+        auto decode( StringWord &out, StringByteView in ) const -> Error;
+        auto decode( StringByte &out, StringByteView in ) const -> Error; // utf-8 output
+        auto decode( char16_t *data, Size size, StringByteView in ) const -> Result;
+        auto decode( char *data, Size size, StringByteView in ) const -> Result;
+        auto decode_append( StringWord &out, StringByteView in ) const -> Result;
+        auto decode_append( StringByte &out, StringByteView in ) const -> Result;
+        [[nodiscard]] auto decoded_size( StringByteView in ) const -> Result;
+        [[nodiscard]] auto can_decode( StringByteView in ) const noexcept -> bool;
+    };
+
+} // namespace
+
+#endif//SON8_CYRILLIC_CODEC_HXX
+
+// Ⓒ 2026 Oleg'Ease'Kharchuk ᦒ
@@ -0,0 +1,33 @@
+#ifndef SON8_CYRILLIC_COLUMN_HXX
+#define SON8_CYRILLIC_COLUMN_HXX
+
+#include <son8/cyrillic/alias.hxx>
+#include <son8/cyrillic/error.hxx>
+// std headers
+#include <vector>
+
+namespace son8::cyrillic {
+
+    // columnar batch output, rows back to back in one arena with offsets table (arrow-like layout)
+    template< typename Char >
+    struct Column final {
+        using Data = std::basic_string< Char >;
+        using View = std::basic_string_view< Char >;
+        Data data;                        // all rows back to back
+        std::vector< Size > offsets{ 0 }; // row i spans [offsets[i], offsets[i + 1])
+        std::vector< Error > errors;      // per row, failed row spans empty range
+        // getters
+        [[nodiscard]] auto size( ) const noexcept -> Size { return errors.size( ); }
+        [[nodiscard]] auto row( Size index ) const -> View { return View{ data }.substr( offsets[index], offsets[index + 1] - offsets[index] ); }
+        // keeps capacity for next batch
+        void clear( ) noexcept { data.clear( ), offsets.resize( 1 ), errors.clear( ); }
+    };
+
+    using EncodedColumn = Column< StringByte::value_type >;
+    using DecodedColumn = Column< StringWord::value_type >;
+
+} // namespace
+
+#endif//SON8_CYRILLIC_COLUMN_HXX
+
+// Ⓒ 2026 Oleg'Ease'Kharchuk ᦒ
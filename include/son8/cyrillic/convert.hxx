@@ -2,11 +2,15 @@
 #define SON8_CYRILLIC_CONVERT_HXX
 
 #include <son8/cyrillic/alias.hxx>
+#include <son8/cyrillic/result.hxx>
 
 namespace son8::cyrillic {
 
     [[nodiscard]] auto string_byte( StringWordView in ) -> StringByte;
     [[nodiscard]] auto string_word( StringByteView in ) -> StringWord;
+    // out is left untouched on failure, read holds offset of first malformed sequence
+    auto string_byte( StringByte &out, StringWordView in ) -> Result;
+    auto string_word( StringWord &out, StringByteView in ) -> Result;
 
 }
 
@@ -1,8 +1,15 @@
 #ifndef SON8_CYRILLIC_DECODE_HXX
 #define SON8_CYRILLIC_DECODE_HXX
 
+#include <son8/cyrillic/decode/append.hxx>
+#include <son8/cyrillic/decode/batch.hxx>
+#include <son8/cyrillic/decode/check.hxx>
+#include <son8/cyrillic/decode/detect.hxx>
 #include <son8/cyrillic/decode/output.hxx>
+#include <son8/cyrillic/decode/parallel.hxx>
 #include <son8/cyrillic/decode/return.hxx>
+#include <son8/cyrillic/decode/size.hxx>
+#include <son8/cyrillic/decode/span.hxx>
 #include <son8/cyrillic/decode/thread.hxx>
 
 #endif//SON8_CYRILLIC_DECODE_HXX
@@ -0,0 +1,20 @@
+#ifndef SON8_CYRILLIC_DECODE_APPEND_HXX
+#define SON8_CYRILLIC_DECODE_APPEND_HXX
+
+#include <son8/cyrillic/alias.hxx>
+#include <son8/cyrillic/result.hxx>
+
+namespace son8::cyrillic {
+    // extends out in place, on failure out keeps output produced before invalid sequence
+    auto decode_append( StringWord &out, StringByteView in ) -> Result;
+    auto decode_append( StringByte &out, StringByteView in ) -> Result; // utf-8 output
+    auto decode_append( StringWordPmr &out, StringByteView in ) -> Result;
+    auto decode_append( StringBytePmr &out, StringByteView in ) -> Result;
+    // resumes at from, e.g. past byte at read of failed call, read stays offset into whole in
+    auto decode_append( StringWord &out, StringByteView in, Size from ) -> Result;
+    auto decode_append( StringByte &out, StringByteView in, Size from ) -> Result;
+} // namespace
+
+#endif//SON8_CYRILLIC_DECODE_APPEND_HXX
+
+// Ⓒ 2026 Oleg'Ease'Kharchuk ᦒ
@@ -0,0 +1,14 @@
+#ifndef SON8_CYRILLIC_DECODE_BATCH_HXX
+#define SON8_CYRILLIC_DECODE_BATCH_HXX
+
+#include <son8/cyrillic/alias.hxx>
+#include <son8/cyrillic/column.hxx>
+
+namespace son8::cyrillic {
+    // appends rows to out, thread state read once per batch, returns number of failed rows
+    auto decode( DecodedColumn &out, StringByteView const *in, Size size ) -> Size;
+} // namespace
+
+#endif//SON8_CYRILLIC_DECODE_BATCH_HXX
+
+// Ⓒ 2026 Oleg'Ease'Kharchuk ᦒ
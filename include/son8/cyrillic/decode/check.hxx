@@ -0,0 +1,14 @@
+#ifndef SON8_CYRILLIC_DECODE_CHECK_HXX
+#define SON8_CYRILLIC_DECODE_CHECK_HXX
+
+#include <son8/cyrillic/alias.hxx>
+
+namespace son8::cyrillic {
+    // classification only, nothing is written or allocated
+    [[nodiscard]] auto can_decode( StringByteView in ) noexcept -> bool;
+    [[nodiscard]] auto count_invalid( StringByteView in ) noexcept -> Size; // failures met resuming past each one
+} // namespace
+
+#endif//SON8_CYRILLIC_DECODE_CHECK_HXX
+
+// Ⓒ 2026 Oleg'Ease'Kharchuk ᦒ
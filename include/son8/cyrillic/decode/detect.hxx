@@ -0,0 +1,16 @@
+#ifndef SON8_CYRILLIC_DECODE_DETECT_HXX
+#define SON8_CYRILLIC_DECODE_DETECT_HXX
+
+#include <son8/cyrillic/alias.hxx>
+#include <son8/cyrillic/detect.hxx>
+#include <son8/cyrillic/error.hxx>
+
+namespace son8::cyrillic {
+    // fails with Error::Language only when j sequences read differently per language and nothing decides
+    auto decode( StringWord &out, StringByteView in, Detect &detect ) -> Error;
+    auto decode( StringByte &out, StringByteView in, Detect &detect ) -> Error; // utf-8 output
+} // namespace
+
+#endif//SON8_CYRILLIC_DECODE_DETECT_HXX
+
+// Ⓒ 2026 Oleg'Ease'Kharchuk ᦒ
@@ -7,6 +7,9 @@
 namespace son8::cyrillic {
     [[nodiscard]]
     auto decode( Decoded::In in, Error &code ) -> Decoded;
+    // output allocated from resource, e.g. arena owned by caller
+    [[nodiscard]]
+    auto decode( Decoded::In in, Error &code, MemoryResource *resource ) -> DecodedPmr;
 } // namespace
 
 #endif//SON8_CYRILLIC_DECODE_OUTPUT_HXX
@@ -0,0 +1,15 @@
+#ifndef SON8_CYRILLIC_DECODE_PARALLEL_HXX
+#define SON8_CYRILLIC_DECODE_PARALLEL_HXX
+
+#include <son8/cyrillic/alias.hxx>
+#include <son8/cyrillic/error.hxx>
+#include <son8/cyrillic/parallel.hxx>
+
+namespace son8::cyrillic {
+    auto decode( StringWord &out, StringByteView in, Parallel parallel ) -> Error;
+    auto decode( StringByte &out, StringByteView in, Parallel parallel ) -> Error; // utf-8 output
+} // namespace
+
+#endif//SON8_CYRILLIC_DECODE_PARALLEL_HXX
+
+// Ⓒ 2026 Oleg'Ease'Kharchuk ᦒ
@@ -6,6 +6,11 @@
 
 namespace son8::cyrillic {
     auto decode( StringWord &out, StringByteView in ) -> Error;
+    // utf-8 output emitted directly
+    auto decode( StringByte &out, StringByteView in ) -> Error;
+    // output allocated from memory resource of out, scratch buffer included
+    auto decode( StringWordPmr &out, StringByteView in ) -> Error;
+    auto decode( StringBytePmr &out, StringByteView in ) -> Error;
 } // namespace
 
 #endif//SON8_CYRILLIC_DECODE_RETURN_HXX
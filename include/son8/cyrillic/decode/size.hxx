@@ -0,0 +1,14 @@
+#ifndef SON8_CYRILLIC_DECODE_SIZE_HXX
+#define SON8_CYRILLIC_DECODE_SIZE_HXX
+
+#include <son8/cyrillic/alias.hxx>
+#include <son8/cyrillic/result.hxx>
+
+namespace son8::cyrillic {
+    // exact decoded size in char16_t units, utf-8 output takes twice as many bytes
+    [[nodiscard]] auto decoded_size( StringByteView in ) -> Result;
+} // namespace
+
+#endif//SON8_CYRILLIC_DECODE_SIZE_HXX
+
+// Ⓒ 2026 Oleg'Ease'Kharchuk ᦒ
@@ -6,6 +6,8 @@
 namespace son8::cyrillic {
     [[nodiscard]]
     auto decode( Decoded::In in ) -> Decoded;
+    [[nodiscard]]
+    auto decode( Decoded::In in, MemoryResource *resource ) -> DecodedPmr;
 } // namespace
 
 #endif//SON8_CYRILLIC_DECODE_THREAD_HXX
@@ -5,8 +5,9 @@
 
 namespace son8::cyrillic {
 
-    class Decoded final {
-        using Data_ = StringWord;
+    // owning decode result, Data is StringWord or allocator-aware string like StringWordPmr
+    template< typename Data_ >
+    class BasicDecoded final {
         Data_ data_;
     public:
         // public aliases
@@ -14,17 +15,20 @@ namespace son8::cyrillic {
         using Data = Data_;
         using Out = Data &;
         using Ref = Data const &;
+        using Ptr = typename Data::value_type *;
         using Fwd = Data &&;
-        using Ptr = Data::value_type *;
         using In = StringByteView;
+        using Allocator = typename Data::allocator_type;
         // constructors
-        Decoded( ) = default;
-       ~Decoded( ) = default;
-        Decoded( In in );
-        Decoded( Decoded &&move ) = default;
-        Decoded( Decoded const &copy ) = default;
-        Decoded &operator=( Decoded &&move ) = default;
-        Decoded &operator=( Decoded const &copy ) = default;
+        BasicDecoded( ) = default;
+       ~BasicDecoded( ) = default;
+        explicit BasicDecoded( Allocator const &allocator ) noexcept;
+        BasicDecoded( In in );
+        BasicDecoded( In in, Allocator const &allocator );
+        BasicDecoded( BasicDecoded &&move ) = default;
+        BasicDecoded( BasicDecoded const &copy ) = default;
+        BasicDecoded &operator=( BasicDecoded &&move ) = default;
+        BasicDecoded &operator=( BasicDecoded const &copy ) = default;
         // getters
         [[nodiscard]] auto ref( ) const & noexcept -> Ref; // reading access via const reference
         [[nodiscard]] auto ptr( ) &       noexcept -> Ptr; // pointer access to underlying data
@@ -35,6 +39,12 @@ namespace son8::cyrillic {
         operator View( ) const;
     };
 
+    using Decoded = BasicDecoded< StringWord >;
+    using DecodedPmr = BasicDecoded< StringWordPmr >;
+    // -- members are defined and instantiated by compiled library
+    extern template class BasicDecoded< StringWord >;
+    extern template class BasicDecoded< StringWordPmr >;
+
 } // namespace
 
 #endif//SON8_CYRILLIC_DECODED_HXX
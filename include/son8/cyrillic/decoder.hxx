@@ -0,0 +1,29 @@
+#ifndef SON8_CYRILLIC_DECODER_HXX
+#define SON8_CYRILLIC_DECODER_HXX
+
+#include <son8/cyrillic/alias.hxx>
+#include <son8/cyrillic/error.hxx>
+#include <son8/cyrillic/state.hxx>
+
+namespace son8::cyrillic {
+
+    // streaming decode, 'j'/'jx' sequences may be split between chunks
+    class Decoder final {
+        Language language_;
+        Unt0 state_; // partial sequence left from previous chunk
+    public:
+        // constructors
+        Decoder( ) noexcept; // captures language of this thread
+        explicit Decoder( Language language ) noexcept;
+        // streaming, on failure sink holds output produced before invalid byte
+        // -- failure also drops partial sequence, so next feed starts fresh as after finish
+        auto feed( StringWord &sink, StringByteView chunk ) -> Error;
+        auto feed( StringByte &sink, StringByteView chunk ) -> Error; // utf-8 output
+        auto finish( ) -> Error; // fails on incomplete sequence, resets for next stream
+    };
+
+} // namespace
+
+#endif//SON8_CYRILLIC_DECODER_HXX
+
+// Ⓒ 2026 Oleg'Ease'Kharchuk ᦒ
@@ -0,0 +1,25 @@
+#ifndef SON8_CYRILLIC_DETECT_HXX
+#define SON8_CYRILLIC_DETECT_HXX
+
+#include <son8/cyrillic/alias.hxx>
+#include <son8/cyrillic/state.hxx>
+
+namespace son8::cyrillic {
+
+    // language picked per call from letters used by only one of languages, thread language untouched
+    struct Detect final {
+        Language fallback{ Language::None }; // when input has none of such letters or as many of both
+        Language detected{ Language::None }; // set by transliteration, none when output does not depend on language
+    };
+
+    // majority of Ё,Ъ,Ы,Э against Є,І,Ї,Ґ in either case
+    [[nodiscard]] auto detect( StringWordView in, Language fallback = Language::None ) noexcept -> Language;
+    [[nodiscard]] auto detect( StringByteView in, Language fallback = Language::None ) noexcept -> Language; // utf-8 text
+    // language of encoder, told apart by jx sequences only, as j sequences are shared by both
+    [[nodiscard]] auto detect_encoded( StringByteView in, Language fallback = Language::None ) noexcept -> Language;
+
+} // namespace
+
+#endif//SON8_CYRILLIC_DETECT_HXX
+
+// Ⓒ 2026 Oleg'Ease'Kharchuk ᦒ
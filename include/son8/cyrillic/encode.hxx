@@ -1,8 +1,15 @@
 #ifndef SON8_CYRILLIC_ENCODE_HXX
 #define SON8_CYRILLIC_ENCODE_HXX
 
+#include <son8/cyrillic/encode/append.hxx>
+#include <son8/cyrillic/encode/batch.hxx>
+#include <son8/cyrillic/encode/check.hxx>
+#include <son8/cyrillic/encode/detect.hxx>
 #include <son8/cyrillic/encode/output.hxx>
+#include <son8/cyrillic/encode/parallel.hxx>
 #include <son8/cyrillic/encode/return.hxx>
+#include <son8/cyrillic/encode/size.hxx>
+#include <son8/cyrillic/encode/span.hxx>
 #include <son8/cyrillic/encode/thread.hxx>
 
 #endif//SON8_CYRILLIC_ENCODE_HXX
@@ -0,0 +1,20 @@
+#ifndef SON8_CYRILLIC_ENCODE_APPEND_HXX
+#define SON8_CYRILLIC_ENCODE_APPEND_HXX
+
+#include <son8/cyrillic/alias.hxx>
+#include <son8/cyrillic/result.hxx>
+
+namespace son8::cyrillic {
+    // extends out in place, on failure out keeps output produced before invalid unit
+    auto encode_append( StringByte &out, StringWordView in ) -> Result;
+    auto encode_append( StringByte &out, StringByteView in ) -> Result; // utf-8 input
+    auto encode_append( StringBytePmr &out, StringWordView in ) -> Result;
+    auto encode_append( StringBytePmr &out, StringByteView in ) -> Result;
+    // resumes at from, e.g. past unit at read of failed call, read stays offset into whole in
+    auto encode_append( StringByte &out, StringWordView in, Size from ) -> Result;
+    auto encode_append( StringByte &out, StringByteView in, Size from ) -> Result;
+} // namespace
+
+#endif//SON8_CYRILLIC_ENCODE_APPEND_HXX
+
+// Ⓒ 2026 Oleg'Ease'Kharchuk ᦒ
@@ -0,0 +1,15 @@
+#ifndef SON8_CYRILLIC_ENCODE_BATCH_HXX
+#define SON8_CYRILLIC_ENCODE_BATCH_HXX
+
+#include <son8/cyrillic/alias.hxx>
+#include <son8/cyrillic/column.hxx>
+
+namespace son8::cyrillic {
+    // appends rows to out, thread state read once per batch, returns number of failed rows
+    auto encode( EncodedColumn &out, StringWordView const *in, Size size ) -> Size;
+    auto encode( EncodedColumn &out, StringByteView const *in, Size size ) -> Size; // utf-8 input
+} // namespace
+
+#endif//SON8_CYRILLIC_ENCODE_BATCH_HXX
+
+// Ⓒ 2026 Oleg'Ease'Kharchuk ᦒ
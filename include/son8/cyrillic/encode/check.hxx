@@ -0,0 +1,18 @@
+#ifndef SON8_CYRILLIC_ENCODE_CHECK_HXX
+#define SON8_CYRILLIC_ENCODE_CHECK_HXX
+
+#include <son8/cyrillic/alias.hxx>
+
+namespace son8::cyrillic {
+    // classification only, nothing is written or allocated
+    [[nodiscard]] auto can_encode( StringWordView in ) noexcept -> bool;
+    [[nodiscard]] auto can_encode( StringByteView in ) noexcept -> bool; // utf-8 input
+    [[nodiscard]] auto count_invalid( StringWordView in ) noexcept -> Size; // units rejected by encode
+    // -- utf-8 input, named apart since count_invalid of bytes counts decode failures
+    // -- rejected code point counts once, every malformed byte counts on its own
+    [[nodiscard]] auto count_invalid_utf8( StringByteView in ) noexcept -> Size;
+} // namespace
+
+#endif//SON8_CYRILLIC_ENCODE_CHECK_HXX
+
+// Ⓒ 2026 Oleg'Ease'Kharchuk ᦒ
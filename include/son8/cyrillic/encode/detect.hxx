@@ -0,0 +1,16 @@
+#ifndef SON8_CYRILLIC_ENCODE_DETECT_HXX
+#define SON8_CYRILLIC_ENCODE_DETECT_HXX
+
+#include <son8/cyrillic/alias.hxx>
+#include <son8/cyrillic/detect.hxx>
+#include <son8/cyrillic/error.hxx>
+
+namespace son8::cyrillic {
+    // validate of this thread is used, language comes from detect
+    auto encode( StringByte &out, StringWordView in, Detect &detect ) -> Error;
+    auto encode( StringByte &out, StringByteView in, Detect &detect ) -> Error; // utf-8 input
+} // namespace
+
+#endif//SON8_CYRILLIC_ENCODE_DETECT_HXX
+
+// Ⓒ 2026 Oleg'Ease'Kharchuk ᦒ
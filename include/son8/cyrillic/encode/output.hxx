@@ -7,6 +7,13 @@
 namespace son8::cyrillic {
     [[nodiscard]]
     auto encode( Encoded::In in, Error &code ) -> Encoded;
+    [[nodiscard]]
+    auto encode( StringByteView in, Error &code ) -> Encoded;
+    // output allocated from resource, e.g. arena owned by caller
+    [[nodiscard]]
+    auto encode( Encoded::In in, Error &code, MemoryResource *resource ) -> EncodedPmr;
+    [[nodiscard]]
+    auto encode( StringByteView in, Error &code, MemoryResource *resource ) -> EncodedPmr;
 } // namespace
 
 #endif//SON8_CYRILLIC_ENCODE_OUTPUT_HXX
@@ -0,0 +1,15 @@
+#ifndef SON8_CYRILLIC_ENCODE_PARALLEL_HXX
+#define SON8_CYRILLIC_ENCODE_PARALLEL_HXX
+
+#include <son8/cyrillic/alias.hxx>
+#include <son8/cyrillic/error.hxx>
+#include <son8/cyrillic/parallel.hxx>
+
+namespace son8::cyrillic {
+    auto encode( StringByte &out, StringWordView in, Parallel parallel ) -> Error;
+    auto encode( StringByte &out, StringByteView in, Parallel parallel ) -> Error; // utf-8 input
+} // namespace
+
+#endif//SON8_CYRILLIC_ENCODE_PARALLEL_HXX
+
+// Ⓒ 2026 Oleg'Ease'Kharchuk ᦒ
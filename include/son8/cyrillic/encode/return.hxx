@@ -6,6 +6,11 @@
 
 namespace son8::cyrillic {
     auto encode( StringByte &out, StringWordView in ) -> Error;
+    // utf-8 input decoded inline, malformed sequence reported as Error::ConvertFailed
+    auto encode( StringByte &out, StringByteView in ) -> Error;
+    // output allocated from memory resource of out, scratch buffer included
+    auto encode( StringBytePmr &out, StringWordView in ) -> Error;
+    auto encode( StringBytePmr &out, StringByteView in ) -> Error;
 } // namespace
 
 #endif//SON8_CYRILLIC_ENCODE_RETURN_HXX
@@ -0,0 +1,15 @@
+#ifndef SON8_CYRILLIC_ENCODE_SIZE_HXX
+#define SON8_CYRILLIC_ENCODE_SIZE_HXX
+
+#include <son8/cyrillic/alias.hxx>
+#include <son8/cyrillic/result.hxx>
+
+namespace son8::cyrillic {
+    // exact encoded size in written, nothing is produced
+    [[nodiscard]] auto encoded_size( StringWordView in ) -> Result;
+    [[nodiscard]] auto encoded_size( StringByteView in ) -> Result; // utf-8 input
+} // namespace
+
+#endif//SON8_CYRILLIC_ENCODE_SIZE_HXX
+
+// Ⓒ 2026 Oleg'Ease'Kharchuk ᦒ
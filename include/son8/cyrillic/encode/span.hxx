@@ -0,0 +1,18 @@
+#ifndef SON8_CYRILLIC_ENCODE_SPAN_HXX
+#define SON8_CYRILLIC_ENCODE_SPAN_HXX
+
+#include <son8/cyrillic/alias.hxx>
+#include <son8/cyrillic/result.hxx>
+
+namespace son8::cyrillic {
+    // writes into caller buffer of given size, Error::OutputOverflow when it does not fit
+    auto encode( char *data, Size size, StringWordView in ) -> Result;
+    auto encode( char *data, Size size, StringByteView in ) -> Result; // utf-8 input
+    // resumes at from, e.g. at read after overflow with fresh buffer, read stays offset into whole in
+    auto encode( char *data, Size size, StringWordView in, Size from ) -> Result;
+    auto encode( char *data, Size size, StringByteView in, Size from ) -> Result;
+} // namespace
+
+#endif//SON8_CYRILLIC_ENCODE_SPAN_HXX
+
+// Ⓒ 2026 Oleg'Ease'Kharchuk ᦒ
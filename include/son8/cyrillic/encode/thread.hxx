@@ -6,6 +6,12 @@
 namespace son8::cyrillic {
     [[nodiscard]]
     auto encode( Encoded::In in ) -> Encoded;
+    [[nodiscard]]
+    auto encode( StringByteView in ) -> Encoded;
+    [[nodiscard]]
+    auto encode( Encoded::In in, MemoryResource *resource ) -> EncodedPmr;
+    [[nodiscard]]
+    auto encode( StringByteView in, MemoryResource *resource ) -> EncodedPmr;
 } // namespace
 
 #endif//SON8_CYRILLIC_ENCODE_THREAD_HXX
@@ -5,8 +5,9 @@
 
 namespace son8::cyrillic {
 
-    class Encoded final {
-        using Data_ = StringByte;
+    // owning encode result, Data is StringByte or allocator-aware string like StringBytePmr
+    template< typename Data_ >
+    class BasicEncoded final {
         Data_ data_;
     public:
         // public aliases
@@ -14,17 +15,20 @@ namespace son8::cyrillic {
         using Data = Data_;
         using Out = Data &;
         using Ref = Data const &;
-        using Ptr = Data::value_type *;
+        using Ptr = typename Data::value_type *;
         using Fwd = Data &&;
         using In = StringWordView;
+        using Allocator = typename Data::allocator_type;
         // constructors
-        Encoded( ) = default;
-       ~Encoded( ) = default;
-        Encoded( In in );
-        Encoded( Encoded &&move ) = default;
-        Encoded( Encoded const &copy ) = default;
-        Encoded &operator=( Encoded &&move ) = default;
-        Encoded &operator=( Encoded const &copy ) = default;
+        BasicEncoded( ) = default;
+       ~BasicEncoded( ) = default;
+        explicit BasicEncoded( Allocator const &allocator ) noexcept;
+        BasicEncoded( In in );
+        BasicEncoded( In in, Allocator const &allocator );
+        BasicEncoded( BasicEncoded &&move ) = default;
+        BasicEncoded( BasicEncoded const &copy ) = default;
+        BasicEncoded &operator=( BasicEncoded &&move ) = default;
+        BasicEncoded &operator=( BasicEncoded const &copy ) = default;
         // getters
         [[nodiscard]] auto ref( ) const & noexcept -> Ref; // reading access via const reference
         [[nodiscard]] auto ptr( ) &       noexcept -> Ptr; // pointer access to underlying data
@@ -35,6 +39,12 @@ namespace son8::cyrillic {
         operator View( ) const;
     };
 
+    using Encoded = BasicEncoded< StringByte >;
+    using EncodedPmr = BasicEncoded< StringBytePmr >;
+    // -- members are defined and instantiated by compiled library
+    extern template class BasicEncoded< StringByte >;
+    extern template class BasicEncoded< StringBytePmr >;
+
 } // namespace
 
 #endif//SON8_CYRILLIC_ENCODED_HXX
@@ -0,0 +1,30 @@
+#ifndef SON8_CYRILLIC_ENCODER_HXX
+#define SON8_CYRILLIC_ENCODER_HXX
+
+#include <son8/cyrillic/alias.hxx>
+#include <son8/cyrillic/error.hxx>
+#include <son8/cyrillic/profile.hxx>
+#include <son8/cyrillic/state.hxx>
+
+namespace son8::cyrillic {
+
+    // streaming encode, input may be split at any point between chunks
+    class Encoder final {
+        Language language_;
+        ValidateProfile profile_; // tables built once, not per feed
+        StringByte pending_; // incomplete utf-8 sequence left from previous chunk
+    public:
+        // constructors
+        Encoder( ) noexcept; // captures language and validate of this thread
+        Encoder( Language language, Validate validate ) noexcept;
+        // streaming, on failure sink holds output produced before invalid unit
+        auto feed( StringByte &sink, StringWordView chunk ) -> Error;
+        auto feed( StringByte &sink, StringByteView chunk ) -> Error; // utf-8 input
+        auto finish( ) -> Error; // fails on incomplete utf-8 sequence, resets for next stream
+    };
+
+} // namespace
+
+#endif//SON8_CYRILLIC_ENCODER_HXX
+
+// Ⓒ 2026 Oleg'Ease'Kharchuk ᦒ
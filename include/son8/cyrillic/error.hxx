@@ -10,6 +10,7 @@ namespace son8::cyrillic {
         InvalidByte,
         ConvertFailed,
         ValidateMisconfigured,
+        OutputOverflow,
         // !IMPORTANT must be last element
         Size_,
     };
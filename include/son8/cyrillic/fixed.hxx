@@ -0,0 +1,132 @@
+#ifndef SON8_CYRILLIC_FIXED_HXX
+#define SON8_CYRILLIC_FIXED_HXX
+
+#include <son8/cyrillic/alias.hxx>
+#include <son8/cyrillic/error.hxx>
+#include <son8/cyrillic/exception.hxx>
+#include <son8/cyrillic/state.hxx>
+#include <son8/cyrillic/table.hxx>
+#include <son8/cyrillic/validate.hxx>
+
+namespace son8::cyrillic {
+
+    // fixed capacity string usable in constant expressions, keeps error of transliteration producing it
+    template< typename Char, Size Capacity >
+    class Fixed final {
+        Char data_[Capacity + 1]{ }; // always zero terminated
+        Size size_{ 0 };
+        Error code_{ Error::None };
+    public:
+        // public aliases
+        using View = std::basic_string_view< Char >;
+        // getters
+        [[nodiscard]] constexpr auto code( ) const noexcept -> Error { return code_; }
+        [[nodiscard]] constexpr auto data( ) const noexcept -> Char const * { return data_; }
+        [[nodiscard]] constexpr auto size( ) const noexcept -> Size { return size_; }
+        [[nodiscard]] constexpr auto view( ) const noexcept -> View { return View{ data_, size_ }; }
+        [[nodiscard]] static constexpr auto capacity( ) noexcept -> Size { return Capacity; }
+        // modifiers, after first failure output is kept as is
+        constexpr void push_back( Char value ) noexcept {
+            if ( code_ != Error::None ) return;
+            if ( size_ == Capacity ) code_ = Error::OutputOverflow;
+            else data_[size_++] = value;
+        }
+        constexpr void fail( Error code ) noexcept { if ( code_ == Error::None ) code_ = code; }
+        // conversions
+        constexpr explicit operator bool( ) const noexcept { return code_ == Error::None; }
+        constexpr operator View( ) const noexcept { return view( ); }
+    };
+
+    template< Size Capacity >
+    using EncodedFixed = Fixed< char, Capacity >;
+    template< Size Capacity >
+    using DecodedFixed = Fixed< char16_t, Capacity >;
+
+    // header-only encode, same output as compiled encode with given language and validate
+    template< Size Capacity >
+    constexpr auto encode_fixed( StringWordView in, Language language, Validate validate = Validate::None ) noexcept -> EncodedFixed< Capacity > {
+        using namespace detail;
+        EncodedFixed< Capacity > out;
+        if ( language == Language::None || Language::Size_ <= language ) return out.fail( Error::Language ), out;
+        auto const &table = Encode_Table_Cyrillic_[static_cast< unsigned >( language ) - 1u];
+        auto const push = [&out]( EncodeGlyph const &glyph ) {
+            for ( Unt0 i = 0; i < glyph.size; ++i ) out.push_back( glyph.data[i] );
+        };
+        for ( Unt2 word : in ) {
+            if ( not out ) break;
+            auto const charHi = word >> 8u;
+            auto const charLo = word & 0xFFu;
+            if ( charHi == Encode_Block_Cyrillic_ && table[charLo].size ) {
+                push( table[charLo] );
+                continue;
+            }
+            bool append = validate == Validate::AppendAll;
+            bool ignore = validate == Validate::IgnoreAll;
+            if ( validate != Validate::None && not append && not ignore ) {
+                auto const flag = charHi ? ValidateFlags::Wide_Bytes
+                    : 0x80u <= charLo ? ValidateFlags::Ascii_Bytes_Extended : Validate_Table_Ascii_[charLo];
+                auto const bit = static_cast< ValidateFlagsVeiled >( flag );
+                auto const mask = static_cast< ValidateVeiled >( validate );
+                append = ( mask >> ( bit + Validate_Half_Bits ) ) & 1u;
+                ignore = ( mask >> bit ) & 1u;
+            }
+            if ( append ) {
+                if ( word < Encode_Ascii_Size_ ) push( Encode_Table_Ascii_[word] );
+                else {
+                    if ( charHi ) out.push_back( static_cast< char >( charHi ) );
+                    out.push_back( static_cast< char >( charLo ) );
+                }
+            } else if ( not ignore ) out.fail( Error::InvalidWord );
+        }
+        return out;
+    }
+
+    // header-only decode, same output as compiled decode with given language
+    template< Size Capacity >
+    constexpr auto decode_fixed( StringByteView in, Language language ) noexcept -> DecodedFixed< Capacity > {
+        using namespace detail;
+        DecodedFixed< Capacity > out;
+        if ( language == Language::None || Language::Size_ <= language ) return out.fail( Error::Language ), out;
+        auto const &table = Decode_Table_[language == Language::Ukrainian];
+        auto state = DecodedState::Defaults;
+        for ( char byte : in ) {
+            auto const step = table[static_cast< unsigned >( state )][static_cast< Unt0 >( byte )];
+            if ( step.next == DecodedState::Error_DS ) return out.fail( Error::InvalidByte ), out;
+            if ( step.word ) out.push_back( step.word );
+            state = step.next;
+        }
+        if ( state != DecodedState::Defaults ) out.fail( Error::InvalidByte );
+        return out;
+    }
+
+    namespace detail {
+        inline constexpr Size Literal_Capacity_{ 256 };
+        // -- failure is compile error in constant evaluation and exception at run time
+        template< typename Fixed >
+        constexpr auto literal( Fixed fixed ) -> Fixed {
+            if ( not fixed ) throw Exception{ fixed.code( ) };
+            return fixed;
+        }
+    } // namespace
+
+    // literals use Validate::None, u"" encodes and plain "" decodes
+    inline namespace literals {
+        constexpr auto operator""_cyr_ru( char16_t const *data, Size size ) -> EncodedFixed< detail::Literal_Capacity_ > {
+            return detail::literal( encode_fixed< detail::Literal_Capacity_ >( StringWordView{ data, size }, Language::Russian ) );
+        }
+        constexpr auto operator""_cyr_ua( char16_t const *data, Size size ) -> EncodedFixed< detail::Literal_Capacity_ > {
+            return detail::literal( encode_fixed< detail::Literal_Capacity_ >( StringWordView{ data, size }, Language::Ukrainian ) );
+        }
+        constexpr auto operator""_cyr_ru( char const *data, Size size ) -> DecodedFixed< detail::Literal_Capacity_ > {
+            return detail::literal( decode_fixed< detail::Literal_Capacity_ >( StringByteView{ data, size }, Language::Russian ) );
+        }
+        constexpr auto operator""_cyr_ua( char const *data, Size size ) -> DecodedFixed< detail::Literal_Capacity_ > {
+            return detail::literal( decode_fixed< detail::Literal_Capacity_ >( StringByteView{ data, size }, Language::Ukrainian ) );
+        }
+    } // namespace
+
+} // namespace
+
+#endif//SON8_CYRILLIC_FIXED_HXX
+
+// Ⓒ 2026 Oleg'Ease'Kharchuk ᦒ
@@ -0,0 +1,18 @@
+#ifndef SON8_CYRILLIC_PARALLEL_HXX
+#define SON8_CYRILLIC_PARALLEL_HXX
+
+#include <son8/cyrillic/alias.hxx>
+
+namespace son8::cyrillic {
+
+    // splits large input into chunks transliterated by worker threads with settings of calling thread
+    struct Parallel final {
+        unsigned threads{ 0 }; // zero picks hardware concurrency
+        Size chunk{ Size{ 1 } << 20 }; // minimal input units per worker, smaller input stays on calling thread
+    };
+
+} // namespace
+
+#endif//SON8_CYRILLIC_PARALLEL_HXX
+
+// Ⓒ 2026 Oleg'Ease'Kharchuk ᦒ
@@ -0,0 +1,34 @@
+#ifndef SON8_CYRILLIC_PROFILE_HXX
+#define SON8_CYRILLIC_PROFILE_HXX
+
+#include <son8/cyrillic/alias.hxx>
+#include <son8/cyrillic/validate.hxx>
+// std headers
+#include <bitset>
+#include <initializer_list>
+
+namespace son8::cyrillic {
+
+    // immutable validate configuration with ascii append and ignore tables built once
+    // -- selected by this_thread::state or codec without rebuilding tables
+    // -- thread selection copies tables, codec keeps its own profile
+    class ValidateProfile final {
+        Validate validate_;
+        std::bitset< 128 > appends_; // ascii appended
+        std::bitset< 128 > ignores_; // ascii ignored
+    public:
+        // constructors
+        ValidateProfile( ) noexcept; // same as Validate::None
+        explicit ValidateProfile( Validate validate ) noexcept; // flag set in both halves is appended
+        ValidateProfile( std::initializer_list< ValidateFlags > appends, std::initializer_list< ValidateFlags > ignores = { } ) noexcept;
+        // getters
+        [[nodiscard]] auto validate( ) const noexcept -> Validate;
+        [[nodiscard]] auto appends( ) const noexcept -> std::bitset< 128 > const &;
+        [[nodiscard]] auto ignores( ) const noexcept -> std::bitset< 128 > const &;
+    };
+
+} // namespace
+
+#endif//SON8_CYRILLIC_PROFILE_HXX
+
+// Ⓒ 2026 Oleg'Ease'Kharchuk ᦒ
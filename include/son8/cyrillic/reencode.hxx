@@ -0,0 +1,23 @@
+#ifndef SON8_CYRILLIC_REENCODE_HXX
+#define SON8_CYRILLIC_REENCODE_HXX
+
+#include <son8/cyrillic/alias.hxx>
+#include <son8/cyrillic/error.hxx>
+#include <son8/cyrillic/result.hxx>
+#include <son8/cyrillic/state.hxx>
+
+namespace son8::cyrillic {
+
+    // encoded text of one language rewritten as encoded text of another in one pass, no decoded copy
+    // -- only j and jx sequences are rewritten, x prefixed and other bytes are copied as they are
+    // -- result equals decode with from and encode with to whenever such decode succeeds
+    auto reencode( StringByte &out, StringByteView in, Language from, Language to ) -> Error;
+    auto reencode( StringBytePmr &out, StringByteView in, Language from, Language to ) -> Error;
+    // extends out in place, on failure out keeps output produced before invalid sequence
+    auto reencode_append( StringByte &out, StringByteView in, Language from, Language to ) -> Result;
+
+} // namespace
+
+#endif//SON8_CYRILLIC_REENCODE_HXX
+
+// Ⓒ 2026 Oleg'Ease'Kharchuk ᦒ
@@ -0,0 +1,21 @@
+#ifndef SON8_CYRILLIC_RESULT_HXX
+#define SON8_CYRILLIC_RESULT_HXX
+
+#include <son8/cyrillic/alias.hxx>
+#include <son8/cyrillic/error.hxx>
+
+namespace son8::cyrillic {
+
+    struct Result final {
+        Error code{ Error::None };
+        Size read{ 0 };    // input units consumed, on failure offset of first invalid unit
+        Size written{ 0 }; // output units produced
+        // conversions
+        explicit operator bool( ) const noexcept { return code == Error::None; }
+    };
+
+} // namespace
+
+#endif//SON8_CYRILLIC_RESULT_HXX
+
+// Ⓒ 2026 Oleg'Ease'Kharchuk ᦒ
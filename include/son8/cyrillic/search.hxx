@@ -0,0 +1,56 @@
+#ifndef SON8_CYRILLIC_SEARCH_HXX
+#define SON8_CYRILLIC_SEARCH_HXX
+
+#include <son8/cyrillic/alias.hxx>
+#include <son8/cyrillic/codec.hxx>
+// std headers
+#include <array>
+#include <initializer_list>
+#include <vector>
+
+namespace son8::cyrillic {
+
+    // match in encoded text, offsets in encoded bytes and in decoded units
+    struct SearchMatch final {
+        Size pattern{ 0 };        // index of matched query
+        Size offset{ 0 };         // encoded
+        Size size{ 0 };           // encoded, zero when nothing found
+        Size decoded_offset{ 0 }; // units of decoded text before match
+        Size decoded_size{ 0 };
+        // conversions
+        explicit operator bool( ) const noexcept { return size != 0; }
+    };
+
+    // queries encoded once, matched against encoded text without decoding it
+    // -- matches start only at sequence boundaries, so j, jx and x prefixes are never split
+    class Search final {
+        std::vector< StringByte > patterns_;
+        std::vector< Size > decoded_;                  // decoded units per pattern
+        std::vector< Size > order_;                    // pattern indices by first byte, longer first
+        std::array< Size, 257 > buckets_{ };           // order_ range per first byte
+        std::array< bool, 256 > stops_{ };             // first bytes of queries and sequence prefixes
+        auto find_at( StringByteView text, Size offset, Size decoded ) const noexcept -> SearchMatch;
+    public:
+        // constructors, query failing to encode throws Exception, empty query never matches
+        Search( std::initializer_list< StringWordView > queries ); // settings of this thread
+        Search( std::vector< StringWordView > const &queries );
+        Search( Codec const &codec, std::initializer_list< StringWordView > queries );
+        Search( Codec const &codec, std::vector< StringWordView > const &queries );
+        // getters
+        [[nodiscard]] auto pattern( Size index ) const noexcept -> StringByteView;
+        [[nodiscard]] auto size( ) const noexcept -> Size;
+        // search, at one offset longest query wins, next match starts after previous one
+        [[nodiscard]] auto find( StringByteView text ) const noexcept -> SearchMatch;
+        [[nodiscard]] auto find( StringByteView text, SearchMatch const &previous ) const noexcept -> SearchMatch;
+        [[nodiscard]] auto contains( StringByteView text ) const noexcept -> bool;
+    };
+
+    // offset map between encoded bytes and decoded units, appended wide words count per byte
+    [[nodiscard]] auto decoded_offset( StringByteView encoded, Size offset ) noexcept -> Size; // units starting before offset
+    [[nodiscard]] auto encoded_offset( StringByteView encoded, Size decoded ) noexcept -> Size; // start of unit, size past end
+
+} // namespace
+
+#endif//SON8_CYRILLIC_SEARCH_HXX
+
+// Ⓒ 2026 Oleg'Ease'Kharchuk ᦒ
@@ -14,6 +14,8 @@ namespace son8::cyrillic {
         Size_
     };
 
+    class ValidateProfile;
+
     namespace this_thread {
         // state setters
         void state( Language language ) noexcept;
@@ -22,6 +24,7 @@ namespace son8::cyrillic {
         void state( ValidateFlagIgnore flag ) noexcept;
         void state( ValidateFlagZeroed flag ) noexcept;
         void state( ValidateVeiled flags ) noexcept;
+        void state( ValidateProfile const &profile ) noexcept; // tables copied, no rebuild
         // state getters
         auto state_language( ) noexcept -> Language;
         auto state_error( ) noexcept -> Error;
@@ -0,0 +1,63 @@
+#ifndef SON8_CYRILLIC_STATS_HXX
+#define SON8_CYRILLIC_STATS_HXX
+
+#include <son8/cyrillic/alias.hxx>
+#include <son8/cyrillic/error.hxx>
+// std headers
+#include <array>
+
+namespace son8::cyrillic {
+
+    enum class StatsKind : unsigned {
+        Encode,
+        Decode,
+        Reencode,
+        // !IMPORTANT must be last element
+        Size_,
+    };
+    // api shape that reached transliteration engine
+    enum class StatsShape : unsigned {
+        String,   // return, output, thread, codec and cache functions
+        Append,
+        Span,
+        Size,     // encoded_size and decoded_size
+        Batch,    // counted per row
+        Parallel, // counted per chunk
+        Stream,   // encoder and decoder feeds
+        Check,    // can_* and count_invalid, nothing is written
+        View,     // lazy views, counted per chunk
+        // !IMPORTANT must be last element
+        Size_,
+    };
+
+    // counters of library work, all zero when library is built with SON8_CYRILLIC_NO_STATS
+    struct Stats final {
+        template< typename Enum >
+        using Array = std::array< Size, static_cast< unsigned >( Enum::Size_ ) >;
+        std::array< Array< StatsShape >, static_cast< unsigned >( StatsKind::Size_ ) > calls{ };
+        Array< StatsKind > input{ };  // bytes read
+        Array< StatsKind > output{ }; // bytes written
+        Array< Error > errors{ };     // failed calls by error, Error::None stays zero
+        Size allocations{ 0 };        // output buffer reservations and calls growing output buffer
+        Size shrinks{ 0 };            // shrink to fit of returned output
+        // getters
+        [[nodiscard]] auto call( StatsKind kind, StatsShape shape ) const noexcept -> Size {
+            return calls[static_cast< unsigned >( kind )][static_cast< unsigned >( shape )];
+        }
+        [[nodiscard]] auto error( Error code ) const noexcept -> Size { return errors[static_cast< unsigned >( code )]; }
+        // modifiers
+        auto operator+=( Stats const &other ) noexcept -> Stats &;
+    };
+
+    // aggregate of live threads and threads already finished, safe to poll from any thread
+    [[nodiscard]] auto stats( ) -> Stats;
+
+    namespace this_thread {
+        [[nodiscard]] auto stats( ) -> Stats;
+    } // namespace
+
+} // namespace
+
+#endif//SON8_CYRILLIC_STATS_HXX
+
+// Ⓒ 2026 Oleg'Ease'Kharchuk ᦒ
@@ -0,0 +1,223 @@
+#ifndef SON8_CYRILLIC_TABLE_HXX
+#define SON8_CYRILLIC_TABLE_HXX
+
+#include <son8/cyrillic/alias.hxx>
+#include <son8/cyrillic/state.hxx>
+// std headers
+#include <array>
+#include <bitset>
+
+// compile-time letter tables shared by compiled library and constexpr header-only path
+namespace son8::cyrillic::detail {
+    // helpers
+    // -- compile-time sorted check for static assert
+    template< typename T >
+    constexpr auto check_sorted( std::basic_string_view< T > t ) -> bool {
+        auto second = t.begin( ) + 1;
+        for ( auto first = t.begin( ); second < t.end( ); ++second ) {
+            if ( *second <= *first ) return false;
+            first = second;
+        }
+        return true;
+    }
+    // encode tables
+    // -- letters
+    inline constexpr StringWordView const Encode_Sumvolu_Plain_{ u"АБВГДЕЖЗИЙКЛМНОПРСТУФХЦЧШЩЬЮЯабвгдежзийклмнопрстуфхцчшщьюя" };
+    static_assert( check_sorted( Encode_Sumvolu_Plain_ ) && Encode_Sumvolu_Plain_.size( ) == 58 );
+    inline constexpr StringWordView const Encode_Sumvolu_Mixed_{ u"ЁЄІЇЪЫЭъыэёєіїҐґ" };
+    static_assert( Encode_Sumvolu_Mixed_.size( ) == 16 );
+    template< unsigned Size >
+    using ArrayViewLetter = std::array< StringByteView, Size >;
+    using ArrayPlain = ArrayViewLetter< Encode_Sumvolu_Plain_.size( ) >;
+    inline constexpr ArrayPlain const Encode_Letters_Plain_{{
+        // x is used to prepend english letters
+        // upper
+        "A", "B", "V", "G", "D", "E","JZ", "Z", // А,Б,В,Г,Д,Е,Ж,З
+        "U", "I", "K", "L", "M", "N", "O", "P", // И,Й,К,Л,М,Н,О,П
+        "R", "S", "T", "Y", "F", "H", "C","JC", // Р,С,Т,У,Ф,Х,Ц,Ч
+        "W","JW", "Q","JY","JA",                // Ш,Щ,Ь,Ю,Я
+        // lower
+        "a", "b", "v", "g", "d", "e","jz", "z", // а,б,в,г,д,е,ж,з
+        "u", "i", "k", "l", "m", "n", "o", "p", // и,й,к,л,м,н,о,п
+        "r", "s", "t", "y", "f", "h", "c","jc", // р,с,т,у,ф,х,ц,ч
+        "w","jw", "q","jy","ja",                // ш,щ,ь,ю,я
+    }};
+    using ArrayMixed = std::array< ArrayViewLetter< Encode_Sumvolu_Mixed_.size( ) >, 2 >;
+    inline constexpr ArrayMixed const Encode_Letters_Mixed_{{
+        //  Ё ,   Є ,   І ,   Ї ,   Ъ ,   Ы ,   Э ,   ъ ,   ы ,   э ,   ё ,   є ,   і ,   ї ,   Ґ ,   ґ
+        { "JI", "JE", "JU", "JI", "JQ", "JU", "JE", "jq", "ju", "je", "ji", "je", "ju", "ji", "JQ", "jq" },
+        {"JXV","JXE","JXI","JXY","JXQ","JXU","JXZ","jxq","jxu","jxz","jxv","jxe","jxi","jxy","JXG","jxg" },
+    }};
+    inline constexpr std::bitset< Encode_Sumvolu_Mixed_.size( ) > Letters_Mixed_Flags_{ 0b1111'1000'0000'1110 };
+    // -- dense tables generated from letters above, one indexed load per code unit
+    struct EncodeGlyph {
+        std::array< char, 3 > data;
+        Unt0 size;
+    };
+    inline constexpr Unt2 Encode_Block_Cyrillic_{ 0x04u }; // high byte of U+0400-U+04FF
+    inline constexpr Size Encode_Block_Size_{ 256 };
+    inline constexpr Size Encode_Ascii_Size_{ 128 };
+    using ArrayGlyphCyrillic = std::array< EncodeGlyph, Encode_Block_Size_ >;
+    using ArrayGlyphAscii = std::array< EncodeGlyph, Encode_Ascii_Size_ >;
+    constexpr auto encode_glyph( StringByteView letter ) -> EncodeGlyph {
+        EncodeGlyph glyph{ };
+        for ( auto letterChar : letter ) glyph.data[glyph.size++] = letterChar;
+        return glyph;
+    }
+    constexpr auto encode_table_cyrillic( Language language ) -> ArrayGlyphCyrillic {
+        ArrayGlyphCyrillic table{ };
+        for ( Size i = 0; i < Encode_Sumvolu_Plain_.size( ); ++i ) {
+            table[Encode_Sumvolu_Plain_[i] & 0xFFu] = encode_glyph( Encode_Letters_Plain_[i] );
+        }
+        bool lang = static_cast< unsigned >( language ) - 1u;
+        for ( Size col = 0; col < Encode_Sumvolu_Mixed_.size( ); ++col ) {
+            auto row = Letters_Mixed_Flags_[col] != lang ? 1 : 0;
+            table[Encode_Sumvolu_Mixed_[col] & 0xFFu] = encode_glyph( Encode_Letters_Mixed_[row][col] );
+        }
+        return table;
+    }
+    // -- ascii table holds appended form, x is used to prepend english letters
+    constexpr auto encode_table_ascii( ) -> ArrayGlyphAscii {
+        ArrayGlyphAscii table{ };
+        for ( Size i = 0; i < table.size( ); ++i ) {
+            auto &glyph = table[i];
+            if/*_*/ ( 'a' <= i && i <= 'z' ) glyph.data[glyph.size++] = 'x';
+            else if ( 'A' <= i && i <= 'Z' ) glyph.data[glyph.size++] = 'X';
+            glyph.data[glyph.size++] = static_cast< char >( i );
+        }
+        return table;
+    }
+    constexpr auto check_block( StringWordView sumvolu ) -> bool {
+        for ( Unt2 word : sumvolu ) if ( ( word >> 8u ) != Encode_Block_Cyrillic_ ) return false;
+        return true;
+    }
+    static_assert( check_block( Encode_Sumvolu_Plain_ ) && check_block( Encode_Sumvolu_Mixed_ ) );
+    using ArrayTableCyrillic = std::array< ArrayGlyphCyrillic, 2 >;
+    inline constexpr ArrayTableCyrillic const Encode_Table_Cyrillic_{{
+        encode_table_cyrillic( Language::Russian ),
+        encode_table_cyrillic( Language::Ukrainian ),
+    }};
+    inline constexpr ArrayGlyphAscii const Encode_Table_Ascii_{ encode_table_ascii( ) };
+    // decode tables
+    // -- letters
+    inline constexpr StringByteView   Decode_Letters_Plain_{ "ABCDEFGHIKLMNOPQRSTUVWYZabcdefghiklmnopqrstuvwyz" };
+    static_assert( check_sorted( Decode_Letters_Plain_ ) );
+    inline constexpr StringWordView Decode_Sumvolu_Plain_{u"АБЦДЕФГХЙКЛМНОПЬРСТИВШУЗабцдефгхйклмнопьрстившуз" };
+    static_assert( Decode_Letters_Plain_.size( ) == Decode_Sumvolu_Plain_.size( ) );
+    using ArrayViewDecodeLetters = std::array< StringByteView, 4 >;
+    inline constexpr ArrayViewDecodeLetters const Decode_Letters_Mixed_{{
+        "zcwyaeiuq",
+        "ZCWYAEIUQ",
+        "quzveiyg",
+        "VEIYQUZG",
+    }};
+    using ArrayViewDecodeSumvolu = std::array< StringWordView, 8 >;
+    inline constexpr ArrayViewDecodeSumvolu const Decode_Sumvolu_Mixed_{{
+       u"жчщюяэёыъ",// ru jj lower
+       u"ЖЧЩЮЯЭЁЫЪ",// ru jj upper
+       u"ъыэёєіїґ", // ru jx lower
+       u"ЁЄІЇЪЫЭҐ", // ru jx upper
+       u"жчщюяєїіґ",// ua jj lower
+       u"ЖЧЩЮЯЄЇІҐ",// ua jj upper
+       u"ъыэёєіїґ", // ua jx lower
+       u"ЁЄІЇЪЫЭҐ", // ua jx upper
+    }};
+    enum class DecodedState : Unt0 {
+        Defaults,
+        Lower_JJ,
+        Upper_JJ,
+        Lower_JX,
+        Upper_JX,
+        Error_DS,
+        // IMPORTANT must be last
+        Size_
+    };
+    // -- transition table generated from letters above, indexed by state and byte
+    struct DecodeStep {
+        DecodedState next;
+        char16_t word; // zero when nothing to push
+    };
+    constexpr auto decoded_state_size( ) -> unsigned { return static_cast< unsigned >( DecodedState::Size_ ); }
+    using ArrayStepByte = std::array< DecodeStep, 256 >;
+    using ArrayStepState = std::array< ArrayStepByte, decoded_state_size( ) >;
+    constexpr auto decode_table_step( ArrayStepByte &steps, StringByteView letters, StringWordView sumvolu ) -> void {
+        for ( Size i = 0; i < letters.size( ); ++i ) {
+            steps[static_cast< Unt0 >( letters[i] )] = DecodeStep{ DecodedState::Defaults, sumvolu[i] };
+        }
+    }
+    constexpr auto decode_table( Language language ) -> ArrayStepState {
+        using State = DecodedState;
+        auto const asi = ( language == Language::Ukrainian ) ? 4 : 0; // array sumvol index
+        ArrayStepState table{ };
+        for ( auto &steps : table ) for ( auto &step : steps ) step = DecodeStep{ State::Error_DS, 0 };
+        auto &defaults = table[static_cast< unsigned >( State::Defaults )];
+        decode_table_step( defaults, Decode_Letters_Plain_, Decode_Sumvolu_Plain_ );
+        defaults['j'] = DecodeStep{ State::Lower_JJ, 0 };
+        defaults['J'] = DecodeStep{ State::Upper_JJ, 0 };
+        // ali (array letter index) follows state order
+        for ( auto ali = 0; ali < 4; ++ali ) {
+            auto &steps = table[static_cast< unsigned >( State::Lower_JJ ) + ali];
+            decode_table_step( steps, Decode_Letters_Mixed_[ali], Decode_Sumvolu_Mixed_[ali + asi] );
+        }
+        table[static_cast< unsigned >( State::Lower_JJ )]['x'] = DecodeStep{ State::Lower_JX, 0 };
+        table[static_cast< unsigned >( State::Upper_JJ )]['X'] = DecodeStep{ State::Upper_JX, 0 };
+        return table;
+    }
+    using ArrayTableDecode = std::array< ArrayStepState, 2 >;
+    inline constexpr ArrayTableDecode const Decode_Table_{{
+        decode_table( Language::Russian ),
+        decode_table( Language::Ukrainian ),
+    }};
+
+    // validate tables
+    // -- ascii code unit to validate flag covering it, same ranges as flag cache of compiled library
+    using ArrayFlagAscii = std::array< ValidateFlags, Encode_Ascii_Size_ >;
+    constexpr auto validate_table_ascii( ) -> ArrayFlagAscii {
+        using F = ValidateFlags;
+        ArrayFlagAscii table{ };
+        for ( auto &flag : table ) flag = F::Size_;
+        for ( Size i = 0x01u; i < 0x20u; ++i ) table[i] = F::Ascii_Bytes_Control;
+        table[0x7Fu] = F::Ascii_Bytes_Control;
+        for ( Size i = 0x30u; i <= 0x39u; ++i ) table[i] = F::Ascii_Range_Digit;
+        for ( Size i = 0x41u; i <= 0x5Au; ++i ) table[i] = F::Ascii_Range_Upper;
+        for ( Size i = 0x61u; i <= 0x7Au; ++i ) table[i] = F::Ascii_Range_Lower;
+        table[0x00u] = F::Ascii_Symbol_Null;
+        table[0x20u] = F::Ascii_Symbol_Space;
+        table[0x5Fu] = F::Ascii_Symbol_Underscore;
+        table[0x60u] = F::Ascii_Symbol_Gravequote;
+        table[0x27u] = F::Ascii_Symbol_Singlequote;
+        table[0x22u] = F::Ascii_Symbol_Doublequote;
+        table[0x5Cu] = F::Ascii_Symbol_Backslash;
+        table[0x07u] = F::Ascii_Symbol_Audio;
+        table[0x08u] = F::Ascii_Symbol_Backspace;
+        table[0x09u] = F::Ascii_Symbol_Tab;
+        table[0x0Au] = F::Ascii_Symbol_Newline;
+        table[0x0Bu] = F::Ascii_Symbol_Verticaltab;
+        table[0x0Cu] = F::Ascii_Symbol_Formfeed;
+        table[0x0Du] = F::Ascii_Symbol_Return;
+        table[0x23u] = F::Ascii_Symbol_Hash;
+        table[0x24u] = F::Ascii_Symbol_Currency;
+        table[0x25u] = F::Ascii_Symbol_Percent;
+        table[0x3Du] = F::Ascii_Symbol_Equal;
+        table[0x40u] = F::Ascii_Symbol_Commercial;
+        table[0x28u] = table[0x29u] = F::Ascii_Brackets_Round;
+        table[0x3Cu] = table[0x3Eu] = F::Ascii_Brackets_Angle;
+        table[0x5Bu] = table[0x5Du] = F::Ascii_Brackets_Array;
+        table[0x7Bu] = table[0x7Du] = F::Ascii_Brackets_Curly;
+        for ( auto i : { 0x21u, 0x2Cu, 0x2Eu, 0x3Au, 0x3Bu, 0x3Fu } ) table[i] = F::Ascii_List_Text;
+        for ( auto i : { 0x26u, 0x5Eu, 0x7Cu, 0x7Eu } ) table[i] = F::Ascii_List_Bitwise;
+        for ( auto i : { 0x2Au, 0x2Bu, 0x2Du, 0x2Fu } ) table[i] = F::Ascii_List_Arithmetic;
+        return table;
+    }
+    inline constexpr ArrayFlagAscii const Validate_Table_Ascii_{ validate_table_ascii( ) };
+    constexpr auto check_covered( ArrayFlagAscii const &table ) -> bool {
+        for ( auto flag : table ) if ( flag == ValidateFlags::Size_ ) return false;
+        return true;
+    }
+    static_assert( check_covered( Validate_Table_Ascii_ ) );
+
+} // namespace
+
+#endif//SON8_CYRILLIC_TABLE_HXX
+
+// Ⓒ 2025-2026 Oleg'Ease'Kharchuk ᦒ
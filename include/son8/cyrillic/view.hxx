@@ -0,0 +1,261 @@
+#ifndef SON8_CYRILLIC_VIEW_HXX
+#define SON8_CYRILLIC_VIEW_HXX
+
+#include <son8/cyrillic/alias.hxx>
+#include <son8/cyrillic/codec.hxx>
+#include <son8/cyrillic/error.hxx>
+#include <son8/cyrillic/result.hxx>
+// std headers
+#include <array>
+#include <iterator>
+#include <string_view>
+#include <type_traits>
+
+namespace son8::cyrillic {
+
+    // lazy transliteration of borrowed input, output units produced on demand without allocation
+    // -- iterator buffers one chunk of kernel output, so views of short keys never touch heap
+    // -- output ends at first invalid unit, same as prefix written by append functions
+    template< typename Char_ >
+    class BasicViewIterator final {
+        using Fill_ = auto ( * )( void const *view, Size read, Char_ *data, Size size ) -> Result;
+        void const *view_{ nullptr };
+        Fill_ fill_{ nullptr };
+        Size read_{ 0 };              // input consumed by buffered chunk
+        Unt1 pos_{ 0 };
+        Unt1 size_{ 0 };              // zero at end
+        Error code_{ Error::None };
+        std::array< Char_, 64 > buffer_;
+        void fill( ) {
+            pos_ = size_ = 0;
+            if ( view_ == nullptr || code_ != Error::None ) return;
+            auto const result = fill_( view_, read_, buffer_.data( ), buffer_.size( ) );
+            read_ += result.read;
+            size_ = static_cast< Unt1 >( result.written );
+            code_ = result.code;
+            if ( size_ == 0 ) view_ = nullptr;
+        }
+    public:
+        // public aliases
+        using Char = Char_;
+        using iterator_category = std::input_iterator_tag;
+        using value_type = Char;
+        using difference_type = std::ptrdiff_t;
+        using pointer = Char const *;
+        using reference = Char const &;
+        // constructors
+        BasicViewIterator( ) noexcept = default; // end
+        BasicViewIterator( void const *view, Fill_ fill ) : view_{ view }, fill_{ fill } { this->fill( ); }
+        // getters
+        [[nodiscard]] auto error( ) const noexcept -> Error { return code_; } // set once input failed, output before it still walked
+        [[nodiscard]] auto chunk( ) const noexcept -> std::basic_string_view< Char > { return { buffer_.data( ) + pos_, Size( size_ - pos_ ) }; }
+        // modifiers
+        void skip( Size count ) { // count up to chunk size
+            pos_ += static_cast< Unt1 >( count );
+            if ( pos_ == size_ ) fill( );
+        }
+        // iterator
+        auto operator*( ) const noexcept -> reference { return buffer_[pos_]; }
+        auto operator++( ) -> BasicViewIterator & { return skip( 1 ), *this; }
+        auto operator++( int ) -> BasicViewIterator { auto copy = *this; return skip( 1 ), copy; }
+        friend bool operator==( BasicViewIterator const &lhs, BasicViewIterator const &rhs ) noexcept {
+            if ( lhs.size_ == 0 || rhs.size_ == 0 ) return lhs.size_ == rhs.size_;
+            return lhs.read_ == rhs.read_ && lhs.pos_ == rhs.pos_;
+        }
+        friend bool operator!=( BasicViewIterator const &lhs, BasicViewIterator const &rhs ) noexcept { return not( lhs == rhs ); }
+    };
+
+    // encode view, In is StringWordView or utf-8 StringByteView
+    // -- without codec settings of this thread are read on each chunk
+    template< typename In_ >
+    class BasicEncodeView final {
+        In_ in_;
+        Codec const *codec_{ nullptr };
+        static auto fill( void const *view, Size read, char *data, Size size ) -> Result;
+    public:
+        // public aliases
+        using In = In_;
+        using Char = char;
+        using Iterator = BasicViewIterator< Char >;
+        // constructors, input and codec must outlive view
+        BasicEncodeView( In in ) noexcept : in_{ in } { }
+        BasicEncodeView( Codec const &codec, In in ) noexcept : in_{ in }, codec_{ &codec } { }
+        // getters
+        [[nodiscard]] auto input( ) const noexcept -> In { return in_; }
+        [[nodiscard]] auto check( ) const -> Result; // output size, same as encoded_size
+        // range
+        [[nodiscard]] auto begin( ) const -> Iterator { return Iterator{ this, &fill }; }
+        [[nodiscard]] auto end( ) const noexcept -> Iterator { return Iterator{ }; }
+    };
+
+    // decode view, Char is char16_t or utf-8 char
+    template< typename Char_ >
+    class BasicDecodeView final {
+        StringByteView in_;
+        Codec const *codec_{ nullptr };
+        static auto fill( void const *view, Size read, Char_ *data, Size size ) -> Result;
+    public:
+        // public aliases
+        using In = StringByteView;
+        using Char = Char_;
+        using Iterator = BasicViewIterator< Char >;
+        // constructors, input and codec must outlive view
+        BasicDecodeView( In in ) noexcept : in_{ in } { }
+        BasicDecodeView( Codec const &codec, In in ) noexcept : in_{ in }, codec_{ &codec } { }
+        // getters
+        [[nodiscard]] auto input( ) const noexcept -> In { return in_; }
+        [[nodiscard]] auto check( ) const -> Result; // output size in Char units
+        // range
+        [[nodiscard]] auto begin( ) const -> Iterator { return Iterator{ this, &fill }; }
+        [[nodiscard]] auto end( ) const noexcept -> Iterator { return Iterator{ }; }
+    };
+
+    using EncodeView = BasicEncodeView< StringWordView >;
+    using EncodeViewUtf8 = BasicEncodeView< StringByteView >;
+    using DecodeView = BasicDecodeView< char16_t >;
+    using DecodeViewUtf8 = BasicDecodeView< char >;
+    // -- members are defined and instantiated by compiled library
+    extern template class BasicEncodeView< StringWordView >;
+    extern template class BasicEncodeView< StringByteView >;
+    extern template class BasicDecodeView< char16_t >;
+    extern template class BasicDecodeView< char >;
+
+    namespace detail {
+        // -- plain strings walk as one chunk, so views and materialized keys mix freely
+        template< typename Char >
+        class ViewCursorPlain {
+            std::basic_string_view< Char > rest_;
+        public:
+            explicit ViewCursorPlain( std::basic_string_view< Char > rest ) noexcept : rest_{ rest } { }
+            auto chunk( ) const noexcept -> std::basic_string_view< Char > { return rest_; }
+            void skip( Size count ) noexcept { rest_.remove_prefix( count ); }
+        };
+        template< typename T, typename = void >
+        struct ViewTraits { };
+        template< typename In >
+        struct ViewTraits< BasicEncodeView< In > > { using Char = char; };
+        template< typename Char_ >
+        struct ViewTraits< BasicDecodeView< Char_ > > { using Char = Char_; };
+        template< typename T >
+        struct ViewTraits< T, std::enable_if_t< std::is_convertible_v< T const &, StringByteView > > > { using Char = char; };
+        template< typename T >
+        struct ViewTraits< T, std::enable_if_t< std::is_convertible_v< T const &, StringWordView > > > { using Char = char16_t; };
+        template< typename T >
+        using ViewChar = typename ViewTraits< T >::Char;
+        template< typename Lhs, typename Rhs >
+        using ViewSame = std::enable_if_t< std::is_same_v< ViewChar< Lhs >, ViewChar< Rhs > >, bool >;
+        template< typename T >
+        auto view_cursor( T const &view ) {
+            using Char = ViewChar< T >;
+            if constexpr ( std::is_convertible_v< T const &, std::basic_string_view< Char > > ) {
+                return ViewCursorPlain< Char >{ std::basic_string_view< Char >( view ) };
+            } else return view.begin( );
+        }
+    } // namespace
+
+    // algorithms over output units of views and plain strings of same unit type, nothing is materialized
+    // -- fnv-1a over units, equal for view and its materialized output
+    template< typename T, typename = detail::ViewChar< T > >
+    [[nodiscard]] auto view_hash( T const &view ) -> Size {
+        Unt3 hash = 0xCBF29CE484222325ull;
+        for ( auto cursor = detail::view_cursor( view ); ; ) {
+            auto const chunk = cursor.chunk( );
+            if ( chunk.empty( ) ) break;
+            for ( auto unit : chunk ) hash = ( hash ^ static_cast< std::make_unsigned_t< decltype( unit ) > >( unit ) ) * 0x100000001B3ull;
+            cursor.skip( chunk.size( ) );
+        }
+        return static_cast< Size >( hash );
+    }
+    // -- lexicographic by unit value, negative zero or positive like string compare
+    template< typename Lhs, typename Rhs, detail::ViewSame< Lhs, Rhs > = true >
+    [[nodiscard]] auto view_compare( Lhs const &lhs, Rhs const &rhs ) -> int {
+        auto l = detail::view_cursor( lhs );
+        auto r = detail::view_cursor( rhs );
+        for ( ;; ) {
+            auto const a = l.chunk( );
+            auto const b = r.chunk( );
+            if ( a.empty( ) || b.empty( ) ) return int( not a.empty( ) ) - int( not b.empty( ) );
+            auto const size = a.size( ) < b.size( ) ? a.size( ) : b.size( );
+            if ( auto const order = a.substr( 0, size ).compare( b.substr( 0, size ) ) ) return order;
+            l.skip( size );
+            r.skip( size );
+        }
+    }
+    template< typename Lhs, typename Rhs, detail::ViewSame< Lhs, Rhs > = true >
+    [[nodiscard]] auto view_equal( Lhs const &lhs, Rhs const &rhs ) -> bool { return view_compare( lhs, rhs ) == 0; }
+    template< typename Text, typename Prefix, detail::ViewSame< Text, Prefix > = true >
+    [[nodiscard]] auto view_starts_with( Text const &text, Prefix const &prefix ) -> bool {
+        auto t = detail::view_cursor( text );
+        auto p = detail::view_cursor( prefix );
+        for ( ;; ) {
+            auto const a = t.chunk( );
+            auto const b = p.chunk( );
+            if ( b.empty( ) ) return true;
+            if ( a.empty( ) ) return false;
+            auto const size = a.size( ) < b.size( ) ? a.size( ) : b.size( );
+            if ( a.substr( 0, size ) != b.substr( 0, size ) ) return false;
+            t.skip( size );
+            p.skip( size );
+        }
+    }
+
+    // transparent functors for hash containers keyed by materialized output
+    // -- map.find( view ) needs C++20 heterogeneous lookup, under C++17 use view_find below
+    struct ViewHash final {
+        using is_transparent = void;
+        template< typename T >
+        auto operator( )( T const &view ) const -> Size { return view_hash( view ); }
+    };
+    struct ViewEqual final {
+        using is_transparent = void;
+        template< typename Lhs, typename Rhs >
+        auto operator( )( Lhs const &lhs, Rhs const &rhs ) const -> bool { return view_equal( lhs, rhs ); }
+    };
+
+    namespace detail {
+        // -- standard libraries known to pick bucket as hash modulo bucket count, power of two mask included
+#if defined( __GLIBCXX__ ) || defined( _LIBCPP_VERSION ) || defined( _MSVC_STL_VERSION )
+        inline constexpr bool View_Bucket_Modulo_ = true;
+#else
+        inline constexpr bool View_Bucket_Modulo_ = false;
+#endif
+        template< typename Map >
+        auto view_key( typename Map::value_type const &value ) -> typename Map::key_type const & {
+            if constexpr ( std::is_same_v< typename Map::key_type, typename Map::value_type > ) return value;
+            else return value.first;
+        }
+    } // namespace
+
+    // lazy probe of unordered set or map hashed by ViewHash, returns end when view is not a key
+    // -- C++17 walks bucket of view_hash, other standard libraries materialize view and call find
+    // -- found key is hashed once more by find to turn bucket position into container iterator,
+    //    so hit costs two hashes and miss one, same as find with materialized key minus allocation
+    template< typename Map, typename View, typename = detail::ViewChar< View > >
+    [[nodiscard]] auto view_find( Map &map, View const &view ) -> decltype( map.begin( ) ) {
+        static_assert( std::is_same_v< typename Map::hasher, ViewHash >, "son8::cyrillic: view_find requires container hashed by ViewHash" );
+        if constexpr ( not detail::View_Bucket_Modulo_ ) {
+            typename Map::key_type key;
+            for ( auto cursor = detail::view_cursor( view ); ; ) {
+                auto const chunk = cursor.chunk( );
+                if ( chunk.empty( ) ) break;
+                key.append( chunk.data( ), chunk.size( ) );
+                cursor.skip( chunk.size( ) );
+            }
+            return map.find( key );
+        } else {
+            auto const count = map.bucket_count( );
+            if ( map.empty( ) || count == 0 ) return map.end( );
+            auto const bucket = view_hash( view ) % count;
+            for ( auto local = map.begin( bucket ); local != map.end( bucket ); ++local ) {
+                auto const &key = detail::view_key< Map >( *local );
+                if ( view_equal( key, view ) ) return map.find( key );
+            }
+            return map.end( );
+        }
+    }
+
+} // namespace
+
+#endif//SON8_CYRILLIC_VIEW_HXX
+
+// Ⓒ 2026 Oleg'Ease'Kharchuk ᦒ
@@ -1,13 +1,32 @@
 #include <son8/cyrillic.hxx>
+#include <son8/cyrillic/table.hxx>
 // std headers
-#include <algorithm> // find, lower_bound
+#include <algorithm> // find, sort
 #include <array> // array
+#include <atomic> // atomic
 #include <bitset> // bitset
 #include <cassert> // (macro) assert
-#include <codecvt> // codecvt_utf8_utf16
-#include <locale> // wstring_convert
+#include <condition_variable> // condition_variable
+#include <cstring> // memcpy
+#include <deque> // deque
+#include <exception> // exception_ptr, rethrow_exception
+#include <memory> // shared_ptr, make_shared
+#include <mutex> // mutex, lock_guard
+#include <string> // basic_string
 #include <string_view> // basic_string_view
+#include <thread> // thread
+#include <type_traits> // is_same_v, make_unsigned_t
+#include <unordered_map> // unordered_map
 #include <utility> // move, pair
+#include <vector> // vector
+// simd headers, SON8_CYRILLIC_NO_SIMD forces scalar kernels
+#if ( defined( __x86_64__ ) || defined( _M_X64 ) ) && !defined( SON8_CYRILLIC_NO_SIMD )
+#define SON8_CYRILLIC_SIMD_X86
+#include <immintrin.h>
+#if defined( _MSC_VER )
+#include <intrin.h> // __cpuidex
+#endif
+#endif
 // macros
 #define STRUCT_VALIDATE_TAG( Name ) template< bool Append, bool Ignore > struct Name{ }
 #define METHOD_VALIDATE_CACHE_UPDATE( Name ) template< bool Append, bool Ignore > void update( Tag::Name< Append, Ignore > )
@@ -25,11 +44,17 @@
         charIgnores_[i] = Ignore;\
     }\
 }
-#define CASE_VALIDATE_FLAG_TAG( Name ) case ValidateFlags::Name: ValidateFlagCache_.update( Tag::Name< Append, Ignore >{ } ); break
+#define CASE_VALIDATE_FLAG_TAG( Name ) case ValidateFlags::Name: cache.update( Tag::Name< Append, Ignore >{ } ); break
+#if defined( __GNUC__ ) || defined( __clang__ )
+#define TARGET_AVX2 __attribute__(( target( "avx2" ) ))
+#else
+#define TARGET_AVX2
+#endif
 // implementation
 namespace son8::cyrillic {
     // private implementation
     namespace {
+        using namespace detail;
         // flag cache helper
         namespace Tag {
             STRUCT_VALIDATE_TAG( Ascii_Symbol_Null );
@@ -63,18 +88,31 @@ namespace son8::cyrillic {
             STRUCT_VALIDATE_TAG( Ascii_List_Arithmetic );
             STRUCT_VALIDATE_TAG( Ascii_Bytes_Control );
         };
-        class CharFlagCache {
+        // -- tables read by kernels, owned by thread cache, codec or profile
+        class CharFlagView {
             // aliases
             using Pair_ = std::pair< bool, bool >;
+            // data
+            std::bitset< 128 > const *charIgnores_;
+            std::bitset< 128 > const *charAppends_;
+        public:
+            CharFlagView( std::bitset< 128 > const &appends, std::bitset< 128 > const &ignores ) noexcept : charIgnores_{ &ignores }, charAppends_{ &appends } { }
+            CharFlagView( ValidateProfile const &profile ) noexcept : CharFlagView{ profile.appends( ), profile.ignores( ) } { }
+            bool append( Unt0 byte ) const { return ( *charAppends_ )[byte]; }
+            bool ignore( Unt0 byte ) const { return ( *charIgnores_ )[byte]; }
+            auto ai_pair( Unt0 byte ) const { return Pair_{ append( byte ), ignore( byte ) }; }
+        };
+        class CharFlagCache {
             // data
             std::bitset< 128 > charIgnores_;
             std::bitset< 128 > charAppends_;
         public:
             CharFlagCache( ) = default;
+            CharFlagCache( std::bitset< 128 > const &appends, std::bitset< 128 > const &ignores ) : charIgnores_{ ignores }, charAppends_{ appends } { }
+            auto appends( ) const -> std::bitset< 128 > const & { return charAppends_; }
+            auto ignores( ) const -> std::bitset< 128 > const & { return charIgnores_; }
+            operator CharFlagView( ) const noexcept { return CharFlagView{ charAppends_, charIgnores_ }; }
             using f = ValidateFlags;
-            bool append( Unt0 byte ) const { return charAppends_[byte]; }
-            bool ignore( Unt0 byte ) const { return charIgnores_[byte]; }
-            auto ai_pair( Unt0 byte ) const { return Pair_{ append( byte ), ignore( byte ) }; }
             void reset( ) { charIgnores_.reset(), charAppends_.reset( ); }
             METHOD_VALIDATE_CACHE_UPDATE_SYMBOL( Ascii_Symbol_Null          , 0x00u )
             METHOD_VALIDATE_CACHE_UPDATE_SYMBOL( Ascii_Symbol_Space         , 0x20u )
@@ -137,8 +175,7 @@ namespace son8::cyrillic {
         thread_local CharFlagCache ValidateFlagCache_{ };
         // update cache
         template< bool Append, bool Ignore >
-        void char_flag_cache_update( ValidateFlags flag ) {
-            using f = ValidateFlags;
+        void char_flag_cache_update( CharFlagCache &cache, ValidateFlags flag ) {
             switch ( flag ) {
             CASE_VALIDATE_FLAG_TAG( Ascii_Symbol_Null );
             CASE_VALIDATE_FLAG_TAG( Ascii_Symbol_Space );
@@ -170,21 +207,14 @@ namespace son8::cyrillic {
             CASE_VALIDATE_FLAG_TAG( Ascii_List_Bitwise );
             CASE_VALIDATE_FLAG_TAG( Ascii_List_Arithmetic );
             CASE_VALIDATE_FLAG_TAG( Ascii_Bytes_Control );
+            // -- bytes above ascii are checked against validate mask directly
+            case ValidateFlags::Ascii_Bytes_Extended: break;
+            case ValidateFlags::Wide_Bytes: break;
             default: {
                 assert( false && "assert should be unreacheble" ); break;
             }}
         }
         // global helpers
-        // -- compile-time sorted check for static assert
-        template< typename T >
-        constexpr auto check_sorted( std::basic_string_view< T > t ) -> bool {
-            auto second = t.begin( ) + 1;
-            for ( auto first = t.begin( ); second < t.end( ); ++second ) {
-                if ( *second <= *first ) return false;
-                first = second;
-            }
-            return true;
-        }
         // -- compile-time language size check for static assert
         constexpr auto check_langsize( unsigned size ) -> bool { return Language::Size_ == static_cast< Language >( size ); }
         static_assert( check_langsize( 3 ) );
@@ -195,8 +225,8 @@ namespace son8::cyrillic {
         // -- check flag is set
         template< bool Append >
         struct validate {
-            bool operator()( ValidateFlags bit ) const noexcept {
-                auto f = this_thread::state_validate_veiled( );
+            bool operator()( Validate validate, ValidateFlags bit ) const noexcept {
+                auto f = static_cast< ValidateVeiled >( validate );
                 auto b = static_cast< ValidateFlagsVeiled >( bit );
                 if constexpr ( Append ) b += Validate_Half_Bits;
                 return f & ( 1ull << b );
@@ -204,79 +234,575 @@ namespace son8::cyrillic {
         };
         using validate_append = validate< ValidateFlagAppend::append >;
         using validate_ignore = validate< ValidateFlagAppend::ignore >;
+        // -- cache rebuilt from validate mask, for settings captured outside of thread state
+        auto char_flag_cache_build( Validate validate ) -> CharFlagCache {
+            CharFlagCache cache;
+            for ( ValidateFlagsVeiled bit = 0; bit < validate_flags_size( ); ++bit ) {
+                auto const flag = static_cast< ValidateFlags >( bit );
+                if/*_*/ ( validate_append{ }( validate, flag ) ) char_flag_cache_update< true, false >( cache, flag );
+                else if ( validate_ignore{ }( validate, flag ) ) char_flag_cache_update< false, true >( cache, flag );
+            }
+            return cache;
+        }
+        // -- settings captured once per call instead of thread state reads per code unit
+        struct Setting {
+            Language language;
+            Validate validate;
+            CharFlagView cache;
+        };
+        auto setting_thread( ) -> Setting { return Setting{ Language_, Validate_, ValidateFlagCache_ }; }
+        auto setting_codec( Codec const &codec ) -> Setting { return Setting{ codec.language( ), codec.validate( ), codec.profile( ) }; }
+        // -- validate specials get own kernel instantiation, anything else goes through cache
+        enum class ValidateMode {
+            None,
+            IgnoreAll,
+            AppendAll,
+            Custom,
+        };
+        // utf-8 detail helpers
+        constexpr Unt2 Utf8_Invalid_{ 0xFFFFFFFFu };
+        constexpr Unt2 Utf16_Supplementary_{ 0x10000u };
+        // -- decodes one code point at index and advances it, rejects overlongs, surrogates and out of range
+        constexpr auto utf8_next( StringByteView in, Size &index ) -> Unt2 {
+            auto const size = in.size( );
+            Unt2 const lead = static_cast< Unt0 >( in[index] );
+            if ( lead < 0x80u ) return ++index, lead;
+            Size need = 0;
+            Unt2 point = 0, least = 0;
+            if/*_*/ ( ( lead & 0xE0u ) == 0xC0u ) need = 1, point = lead & 0x1Fu, least = 0x80u;
+            else if ( ( lead & 0xF0u ) == 0xE0u ) need = 2, point = lead & 0x0Fu, least = 0x800u;
+            else if ( ( lead & 0xF8u ) == 0xF0u ) need = 3, point = lead & 0x07u, least = 0x10000u;
+            else return Utf8_Invalid_;
+            if ( size - index <= need ) return Utf8_Invalid_;
+            for ( Size i = 1; i <= need; ++i ) {
+                Unt2 const next = static_cast< Unt0 >( in[index + i] );
+                if ( ( next & 0xC0u ) != 0x80u ) return Utf8_Invalid_;
+                point = ( point << 6u ) | ( next & 0x3Fu );
+            }
+            if ( point < least || point > 0x10FFFFu ) return Utf8_Invalid_;
+            if ( 0xD800u <= point && point <= 0xDFFFu ) return Utf8_Invalid_;
+            index += need + 1;
+            return point;
+        }
+        // -- code points of input, each malformed byte counted as unit of its own
+        constexpr auto utf8_units( StringByteView in ) -> Size {
+            Size count = 0;
+            for ( Size i = 0; i < in.size( ); ++count ) if ( utf8_next( in, i ) == Utf8_Invalid_ ) ++i;
+            return count;
+        }
+        // -- sequence length from lead byte, zero for continuation or invalid lead
+        constexpr auto utf8_length( Unt0 lead ) -> Size {
+            if/*_*/ ( lead < 0x80u ) return 1;
+            else if ( ( lead & 0xE0u ) == 0xC0u ) return 2;
+            else if ( ( lead & 0xF0u ) == 0xE0u ) return 3;
+            else if ( ( lead & 0xF8u ) == 0xF0u ) return 4;
+            return 0;
+        }
+        // -- size of incomplete sequence at the end of chunk, to be completed by next one
+        constexpr auto utf8_tail( StringByteView in ) -> Size {
+            for ( Size back = 1; back <= 3 && back <= in.size( ); ++back ) {
+                auto const byte = static_cast< Unt0 >( in[in.size( ) - back] );
+                if ( ( byte & 0xC0u ) == 0x80u ) continue;
+                return utf8_length( byte ) > back ? back : 0;
+            }
+            return 0;
+        }
+        // -- fast check for valid two byte sequence, most common for cyrillic
+        constexpr auto utf8_pair( StringByteView in, Size index ) -> bool {
+            if ( in.size( ) - index < 2 ) return false;
+            Unt2 const lead = static_cast< Unt0 >( in[index] );
+            return 0xC2u <= lead && lead <= 0xDFu && ( static_cast< Unt0 >( in[index + 1] ) & 0xC0u ) == 0x80u;
+        }
+        constexpr auto utf16_surrogates( Unt2 point ) -> std::pair< char16_t, char16_t > {
+            point -= Utf16_Supplementary_;
+            return { static_cast< char16_t >( 0xD800u + ( point >> 10u ) ), static_cast< char16_t >( 0xDC00u + ( point & 0x3FFu ) ) };
+        }
+        // -- writes valid code point and returns past the end of written sequence
+        constexpr auto utf8_write( char *out, Unt2 point ) -> char * {
+            if/*_*/ ( point < 0x80u ) *out++ = static_cast< char >( point );
+            else if ( point < 0x800u ) {
+                *out++ = static_cast< char >( 0xC0u | ( point >> 6u ) );
+                *out++ = static_cast< char >( 0x80u | ( point & 0x3Fu ) );
+            } else if ( point < Utf16_Supplementary_ ) {
+                *out++ = static_cast< char >( 0xE0u | ( point >> 12u ) );
+                *out++ = static_cast< char >( 0x80u | ( ( point >> 6u ) & 0x3Fu ) );
+                *out++ = static_cast< char >( 0x80u | ( point & 0x3Fu ) );
+            } else {
+                *out++ = static_cast< char >( 0xF0u | ( point >> 18u ) );
+                *out++ = static_cast< char >( 0x80u | ( ( point >> 12u ) & 0x3Fu ) );
+                *out++ = static_cast< char >( 0x80u | ( ( point >> 6u ) & 0x3Fu ) );
+                *out++ = static_cast< char >( 0x80u | ( point & 0x3Fu ) );
+            }
+            return out;
+        }
+        // simd detail implementation
+        // -- plain ascii is not a latin letter, so its appended encoded form is the same single byte
+        constexpr auto ascii_latin( Unt2 word ) -> bool { return ( ( word | 0x20u ) - 'a' ) <= ( 'z' - 'a' ); }
+        constexpr auto ascii_plain( Unt2 word ) -> bool { return word < 0x80u && not ascii_latin( word ); }
+        // -- kernels measure leading ascii runs (span) and move them between byte and word strings
+        template< bool Plain, typename Char >
+        auto ascii_span_scalar( Char const *in, Size size ) -> Size {
+            using Unit = std::make_unsigned_t< Char >;
+            Size i = 0;
+            if constexpr ( Plain ) while ( i < size && ascii_plain( static_cast< Unit >( in[i] ) ) ) ++i;
+            else while ( i < size && static_cast< Unit >( in[i] ) < 0x80u ) ++i;
+            return i;
+        }
+        // -- ascii set as bitmap, row per low nibble and bit per high nibble, so vector kernels look it up by shuffle
+        using AsciiMask = std::array< Unt0, 16 >;
+        constexpr auto ascii_mask_test( AsciiMask const &mask, Unt2 word ) -> bool {
+            return word < 0x80u && ( mask[word & 0xFu] >> ( word >> 4u ) & 1u );
+        }
+        template< typename Char >
+        auto ascii_mask_scalar( Char const *in, Size size, AsciiMask const &mask ) -> Size {
+            Size i = 0;
+            while ( i < size && ascii_mask_test( mask, static_cast< std::make_unsigned_t< Char > >( in[i] ) ) ) ++i;
+            return i;
+        }
+        // -- plain ascii appended by validate tables, copied through unchanged like under AppendAll
+        auto ascii_mask_append( CharFlagView const &cache ) -> AsciiMask {
+            AsciiMask mask{ };
+            for ( Unt0 byte = 0; byte < 0x80u; ++byte ) {
+                if ( ascii_plain( byte ) && cache.append( byte ) ) mask[byte & 0xFu] |= static_cast< Unt0 >( 1u << ( byte >> 4u ) );
+            }
+            return mask;
+        }
+        void ascii_narrow_scalar( char *out, char16_t const *in, Size size ) {
+            for ( Size i = 0; i < size; ++i ) out[i] = static_cast< char >( in[i] );
+        }
+        void ascii_widen_scalar( char16_t *out, char const *in, Size size ) {
+            for ( Size i = 0; i < size; ++i ) out[i] = static_cast< Unt0 >( in[i] );
+        }
+#ifdef SON8_CYRILLIC_SIMD_X86
+        // -- lanes are ascii when below 0x80, plain when also not in a-z after folding case
+        template< bool Plain >
+        auto ascii_words_sse2( __m128i words ) -> __m128i {
+            auto const zero = _mm_setzero_si128( );
+            auto const ascii = _mm_cmpeq_epi16( _mm_subs_epu16( words, _mm_set1_epi16( 0x7F ) ), zero );
+            if constexpr ( not Plain ) return ascii;
+            auto const fold = _mm_sub_epi16( _mm_or_si128( words, _mm_set1_epi16( 0x20 ) ), _mm_set1_epi16( 'a' ) );
+            auto const latin = _mm_cmpeq_epi16( _mm_subs_epu16( fold, _mm_set1_epi16( 'z' - 'a' ) ), zero );
+            return _mm_andnot_si128( latin, ascii );
+        }
+        template< bool Plain >
+        auto ascii_span_sse2( char16_t const *in, Size size ) -> Size {
+            Size i = 0;
+            for ( ; i + 16 <= size; i += 16 ) {
+                auto const lo = _mm_loadu_si128( reinterpret_cast< __m128i const * >( in + i ) );
+                auto const hi = _mm_loadu_si128( reinterpret_cast< __m128i const * >( in + i + 8 ) );
+                auto const pack = _mm_packs_epi16( ascii_words_sse2< Plain >( lo ), ascii_words_sse2< Plain >( hi ) );
+                if ( _mm_movemask_epi8( pack ) != 0xFFFF ) return i + ascii_span_scalar< Plain >( in + i, 16 );
+            }
+            return i + ascii_span_scalar< Plain >( in + i, size - i );
+        }
+        // -- lanes with high bit set are not ascii, plain also marks latin letters that way
+        template< bool Plain >
+        auto ascii_bytes_sse2( __m128i bytes ) -> __m128i {
+            if constexpr ( not Plain ) return bytes;
+            auto const fold = _mm_sub_epi8( _mm_or_si128( bytes, _mm_set1_epi8( 0x20 ) ), _mm_set1_epi8( 'a' ) );
+            auto const latin = _mm_cmpeq_epi8( _mm_subs_epu8( fold, _mm_set1_epi8( 'z' - 'a' ) ), _mm_setzero_si128( ) );
+            return _mm_or_si128( bytes, latin );
+        }
+        template< bool Plain >
+        auto ascii_span_sse2( char const *in, Size size ) -> Size {
+            Size i = 0;
+            for ( ; i + 16 <= size; i += 16 ) {
+                auto const bytes = _mm_loadu_si128( reinterpret_cast< __m128i const * >( in + i ) );
+                if ( _mm_movemask_epi8( ascii_bytes_sse2< Plain >( bytes ) ) != 0 ) return i + ascii_span_scalar< Plain >( in + i, 16 );
+            }
+            return i + ascii_span_scalar< Plain >( in + i, size - i );
+        }
+        void ascii_narrow_sse2( char *out, char16_t const *in, Size size ) {
+            Size i = 0;
+            for ( ; i + 16 <= size; i += 16 ) {
+                auto const lo = _mm_loadu_si128( reinterpret_cast< __m128i const * >( in + i ) );
+                auto const hi = _mm_loadu_si128( reinterpret_cast< __m128i const * >( in + i + 8 ) );
+                _mm_storeu_si128( reinterpret_cast< __m128i * >( out + i ), _mm_packus_epi16( lo, hi ) );
+            }
+            ascii_narrow_scalar( out + i, in + i, size - i );
+        }
+        void ascii_widen_sse2( char16_t *out, char const *in, Size size ) {
+            Size i = 0;
+            auto const zero = _mm_setzero_si128( );
+            for ( ; i + 16 <= size; i += 16 ) {
+                auto const bytes = _mm_loadu_si128( reinterpret_cast< __m128i const * >( in + i ) );
+                _mm_storeu_si128( reinterpret_cast< __m128i * >( out + i ), _mm_unpacklo_epi8( bytes, zero ) );
+                _mm_storeu_si128( reinterpret_cast< __m128i * >( out + i + 8 ), _mm_unpackhi_epi8( bytes, zero ) );
+            }
+            ascii_widen_scalar( out + i, in + i, size - i );
+        }
+        template< bool Plain >
+        TARGET_AVX2 auto ascii_words_avx2( __m256i words ) -> __m256i {
+            auto const zero = _mm256_setzero_si256( );
+            auto const ascii = _mm256_cmpeq_epi16( _mm256_subs_epu16( words, _mm256_set1_epi16( 0x7F ) ), zero );
+            if constexpr ( not Plain ) return ascii;
+            auto const fold = _mm256_sub_epi16( _mm256_or_si256( words, _mm256_set1_epi16( 0x20 ) ), _mm256_set1_epi16( 'a' ) );
+            auto const latin = _mm256_cmpeq_epi16( _mm256_subs_epu16( fold, _mm256_set1_epi16( 'z' - 'a' ) ), zero );
+            return _mm256_andnot_si256( latin, ascii );
+        }
+        template< bool Plain >
+        TARGET_AVX2 auto ascii_span_avx2( char16_t const *in, Size size ) -> Size {
+            Size i = 0;
+            for ( ; i + 32 <= size; i += 32 ) {
+                auto const lo = _mm256_loadu_si256( reinterpret_cast< __m256i const * >( in + i ) );
+                auto const hi = _mm256_loadu_si256( reinterpret_cast< __m256i const * >( in + i + 16 ) );
+                auto const pack = _mm256_packs_epi16( ascii_words_avx2< Plain >( lo ), ascii_words_avx2< Plain >( hi ) );
+                if ( static_cast< Unt2 >( _mm256_movemask_epi8( pack ) ) != 0xFFFFFFFFu ) break;
+            }
+            // clean upper state before sse2 tail, otherwise every call pays transition penalty
+            _mm256_zeroupper( );
+            return i + ascii_span_sse2< Plain >( in + i, size - i );
+        }
+        template< bool Plain >
+        TARGET_AVX2 auto ascii_bytes_avx2( __m256i bytes ) -> __m256i {
+            if constexpr ( not Plain ) return bytes;
+            auto const fold = _mm256_sub_epi8( _mm256_or_si256( bytes, _mm256_set1_epi8( 0x20 ) ), _mm256_set1_epi8( 'a' ) );
+            auto const latin = _mm256_cmpeq_epi8( _mm256_subs_epu8( fold, _mm256_set1_epi8( 'z' - 'a' ) ), _mm256_setzero_si256( ) );
+            return _mm256_or_si256( bytes, latin );
+        }
+        template< bool Plain >
+        TARGET_AVX2 auto ascii_span_avx2( char const *in, Size size ) -> Size {
+            Size i = 0;
+            for ( ; i + 32 <= size; i += 32 ) {
+                auto const bytes = _mm256_loadu_si256( reinterpret_cast< __m256i const * >( in + i ) );
+                if ( _mm256_movemask_epi8( ascii_bytes_avx2< Plain >( bytes ) ) != 0 ) break;
+            }
+            _mm256_zeroupper( );
+            return i + ascii_span_sse2< Plain >( in + i, size - i );
+        }
+        // -- lanes outside of mask are zero, bytes above 0x7F pick zero bit from upper half of bits
+        TARGET_AVX2 auto ascii_mask_avx2( __m256i bytes, __m256i rows ) -> __m256i {
+            auto const bits = _mm256_setr_epi8( 1, 2, 4, 8, 16, 32, 64, -128, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 4, 8, 16, 32, 64, -128, 0, 0, 0, 0, 0, 0, 0, 0 );
+            auto const nibble = _mm256_set1_epi8( 0x0F );
+            auto const row = _mm256_shuffle_epi8( rows, _mm256_and_si256( bytes, nibble ) );
+            auto const bit = _mm256_shuffle_epi8( bits, _mm256_and_si256( _mm256_srli_epi16( bytes, 4 ), nibble ) );
+            return _mm256_and_si256( row, bit );
+        }
+        // -- words saturate to 0xFF when packed, order of packed lanes is irrelevant for all-in-mask test
+        template< typename Char >
+        TARGET_AVX2 auto ascii_mask_span_avx2( Char const *in, Size size, AsciiMask const &mask ) -> Size {
+                auto const rows = _mm256_broadcastsi128_si256( _mm_loadu_si128( reinterpret_cast< __m128i const * >( mask.data( ) ) ) );
+            auto const zero = _mm256_setzero_si256( );
+            Size i = 0;
+            for ( ; i + 32 <= size; i += 32 ) {
+                __m256i bytes;
+                if constexpr ( std::is_same_v< Char, char > ) bytes = _mm256_loadu_si256( reinterpret_cast< __m256i const * >( in + i ) );
+                else {
+                    auto const lo = _mm256_loadu_si256( reinterpret_cast< __m256i const * >( in + i ) );
+                    auto const hi = _mm256_loadu_si256( reinterpret_cast< __m256i const * >( in + i + 16 ) );
+                    bytes = _mm256_packus_epi16( lo, hi );
+                }
+                auto const outside = _mm256_cmpeq_epi8( ascii_mask_avx2( bytes, rows ), zero );
+                if ( _mm256_movemask_epi8( outside ) != 0 ) break;
+            }
+            _mm256_zeroupper( );
+            return i + ascii_mask_scalar( in + i, size - i, mask );
+        }
+        TARGET_AVX2 void ascii_narrow_avx2( char *out, char16_t const *in, Size size ) {
+            Size i = 0;
+            for ( ; i + 32 <= size; i += 32 ) {
+                auto const lo = _mm256_loadu_si256( reinterpret_cast< __m256i const * >( in + i ) );
+                auto const hi = _mm256_loadu_si256( reinterpret_cast< __m256i const * >( in + i + 16 ) );
+                // packus works per 128-bit lane, permute restores order of quadwords
+                auto const pack = _mm256_permute4x64_epi64( _mm256_packus_epi16( lo, hi ), 0xD8 );
+                _mm256_storeu_si256( reinterpret_cast< __m256i * >( out + i ), pack );
+            }
+            _mm256_zeroupper( );
+            ascii_narrow_sse2( out + i, in + i, size - i );
+        }
+        TARGET_AVX2 void ascii_widen_avx2( char16_t *out, char const *in, Size size ) {
+            Size i = 0;
+            for ( ; i + 16 <= size; i += 16 ) {
+                auto const bytes = _mm_loadu_si128( reinterpret_cast< __m128i const * >( in + i ) );
+                _mm256_storeu_si256( reinterpret_cast< __m256i * >( out + i ), _mm256_cvtepu8_epi16( bytes ) );
+            }
+            _mm256_zeroupper( );
+            ascii_widen_sse2( out + i, in + i, size - i );
+        }
+        auto simd_avx2( ) -> bool {
+#if defined( _MSC_VER ) && !defined( __clang__ )
+            int info[4];
+            __cpuidex( info, 1, 0 );
+            bool const osxsave = info[2] & ( 1 << 27 );
+            if ( not osxsave || ( _xgetbv( 0 ) & 0x6u ) != 0x6u ) return false;
+            __cpuidex( info, 7, 0 );
+            return info[1] & ( 1 << 5 );
+#else
+            return __builtin_cpu_supports( "avx2" );
+#endif
+        }
+#endif
+        struct SimdKernels {
+            auto ( *plain )( char16_t const *in, Size size ) -> Size; // ascii other than latin letters
+            auto ( *plain_bytes )( char const *in, Size size ) -> Size;
+            auto ( *words )( char16_t const *in, Size size ) -> Size;
+            auto ( *bytes )( char const *in, Size size ) -> Size;
+            auto ( *mask_words )( char16_t const *in, Size size, AsciiMask const &mask ) -> Size; // ascii in mask only
+            auto ( *mask_bytes )( char const *in, Size size, AsciiMask const &mask ) -> Size;
+            void ( *narrow )( char *out, char16_t const *in, Size size );
+            void ( *widen )( char16_t *out, char const *in, Size size );
+        };
+        // -- runtime dispatch, resolved once on first use
+        auto simd_kernels( ) -> SimdKernels const & {
+            static SimdKernels const kernels = [] {
+#ifdef SON8_CYRILLIC_SIMD_X86
+                if ( simd_avx2( ) ) return SimdKernels{
+                    ascii_span_avx2< true >, ascii_span_avx2< true >, ascii_span_avx2< false >, ascii_span_avx2< false >,
+                    ascii_mask_span_avx2, ascii_mask_span_avx2, ascii_narrow_avx2, ascii_widen_avx2 };
+                // -- sse2 has no byte shuffle, mask is tested unit by unit
+                return SimdKernels{
+                    ascii_span_sse2< true >, ascii_span_sse2< true >, ascii_span_sse2< false >, ascii_span_sse2< false >,
+                    ascii_mask_scalar, ascii_mask_scalar, ascii_narrow_sse2, ascii_widen_sse2 };
+#else
+                return SimdKernels{
+                    ascii_span_scalar< true >, ascii_span_scalar< true >, ascii_span_scalar< false >, ascii_span_scalar< false >,
+                    ascii_mask_scalar, ascii_mask_scalar, ascii_narrow_scalar, ascii_widen_scalar };
+#endif
+            }( );
+            return kernels;
+        }
+        // -- short runs are cheaper inline, kernels take over once run reaches threshold
+        constexpr Size Simd_Threshold_{ 16 };
+        template< bool Plain, typename Char, typename Span >
+        auto ascii_run( Char const *in, Size size, Span span ) -> Size {
+            auto run = ascii_span_scalar< Plain >( in, size < Simd_Threshold_ ? size : Simd_Threshold_ );
+            if ( run == Simd_Threshold_ ) run += span( in + run, size - run );
+            return run;
+        }
+        template< typename Char, typename Span >
+        auto ascii_run( Char const *in, Size size, AsciiMask const &mask, Span span ) -> Size {
+            auto run = ascii_mask_scalar( in, size < Simd_Threshold_ ? size : Simd_Threshold_, mask );
+            if ( run == Simd_Threshold_ ) run += span( in + run, size - run, mask );
+            return run;
+        }
+        template< typename Out, typename In, typename Copy >
+        void ascii_copy( Out *out, In const *in, Size size, Copy copy ) {
+            if ( size < Simd_Threshold_ ) for ( Size i = 0; i < size; ++i ) out[i] = static_cast< Out >( in[i] );
+            else copy( out, in, size );
+        }
+        // stats detail implementation
+        // -- SON8_CYRILLIC_NO_STATS keeps api but never touches counters
+#ifdef SON8_CYRILLIC_NO_STATS
+        constexpr bool Stats_Enabled_ = false;
+#else
+        constexpr bool Stats_Enabled_ = true;
+#endif
+        // -- counters written by owning thread only, atomics let snapshot read them without lock
+        using StatsCounter = std::atomic< Size >;
+        template< typename Enum >
+        using StatsCounters = std::array< StatsCounter, static_cast< unsigned >( Enum::Size_ ) >;
+        struct StatsBlock {
+            std::array< StatsCounters< StatsShape >, static_cast< unsigned >( StatsKind::Size_ ) > calls{ };
+            StatsCounters< StatsKind > input{ };
+            StatsCounters< StatsKind > output{ };
+            StatsCounters< Error > errors{ };
+            StatsCounter allocations{ 0 };
+            StatsCounter shrinks{ 0 };
+            auto load( ) const noexcept -> Stats {
+                auto const get = []( StatsCounter const &counter ) { return counter.load( std::memory_order_relaxed ); };
+                Stats ret;
+                for ( Size k = 0; k < ret.calls.size( ); ++k ) {
+                    for ( Size s = 0; s < ret.calls[k].size( ); ++s ) ret.calls[k][s] = get( calls[k][s] );
+                    ret.input[k] = get( input[k] );
+                    ret.output[k] = get( output[k] );
+                }
+                for ( Size e = 0; e < ret.errors.size( ); ++e ) ret.errors[e] = get( errors[e] );
+                ret.allocations = get( allocations );
+                ret.shrinks = get( shrinks );
+                return ret;
+            }
+        };
+        // -- per thread counters, constant initialized so hot path reads plain thread storage without init guard
+        struct StatsThread {
+            StatsBlock block;
+            Size slot;            // index in registry live list, valid while registered
+            bool registered;
+        };
+        thread_local StatsThread Stats_{ };
+        struct StatsRegistry {
+            std::mutex mutex;
+            std::vector< StatsThread * > live;
+            Stats retired; // sum of finished threads
+        };
+        // -- never destroyed, detached threads may finish after static destruction
+        auto stats_registry( ) -> StatsRegistry & {
+            static auto *registry = new StatsRegistry;
+            return *registry;
+        }
+        // -- registration lives only in cold path, pooled workers stay registered for process lifetime
+        class StatsRetire {
+        public:
+            StatsRetire( ) {
+                auto &registry = stats_registry( );
+                std::lock_guard< std::mutex > lock{ registry.mutex };
+                Stats_.slot = registry.live.size( );
+                registry.live.push_back( &Stats_ );
+                Stats_.registered = true;
+            }
+           ~StatsRetire( ) {
+                auto &registry = stats_registry( );
+                std::lock_guard< std::mutex > lock{ registry.mutex };
+                registry.retired += Stats_.block.load( );
+                auto &live = registry.live;
+                live[Stats_.slot] = live.back( );
+                live[Stats_.slot]->slot = Stats_.slot;
+                live.pop_back( );
+            }
+            StatsRetire( StatsRetire const & ) = delete;
+            StatsRetire &operator=( StatsRetire const & ) = delete;
+        };
+        void stats_register( ) { thread_local StatsRetire const retire; }
+        // -- callers are noexcept, failed registration (bad_alloc, system_error) is retried on next call,
+        //    meanwhile counts still land in thread block but are missing from aggregate stats
+        auto stats_block( ) noexcept -> StatsBlock & {
+            if ( not Stats_.registered ) try { stats_register( ); } catch ( ... ) { }
+            return Stats_.block;
+        }
+        void stats_add( StatsCounter &counter, Size value ) noexcept {
+            counter.store( counter.load( std::memory_order_relaxed ) + value, std::memory_order_relaxed );
+        }
+        template< typename In >
+        void stats_call( StatsKind kind, StatsShape shape, In in, Size written, Error code ) noexcept {
+            if constexpr ( Stats_Enabled_ ) {
+                auto &block = stats_block( );
+                auto const k = static_cast< unsigned >( kind );
+                stats_add( block.calls[k][static_cast< unsigned >( shape )], 1 );
+                stats_add( block.input[k], in.size( ) * sizeof( typename In::value_type ) );
+                stats_add( block.output[k], written );
+                if ( code != Error::None ) stats_add( block.errors[static_cast< unsigned >( code )], 1 );
+            }
+        }
+        void stats_allocation( ) noexcept { if constexpr ( Stats_Enabled_ ) stats_add( stats_block( ).allocations, 1 ); }
+        void stats_shrink( ) noexcept { if constexpr ( Stats_Enabled_ ) stats_add( stats_block( ).shrinks, 1 ); }
+        // sink detail implementation
+        // -- sinks receive engine output: string appends, span writes in place, count only measures
+        template< typename Char, typename Data = std::basic_string< Char >, StatsShape Shape_ = StatsShape::Append >
+        class SinkString {
+            Data &out_;
+        public:
+            static constexpr bool Bounded = false;
+            static constexpr StatsShape Shape = Shape_;
+            explicit SinkString( Data &out ) noexcept : out_{ out } { }
+            auto size( ) const noexcept -> Size { return out_.size( ); }
+            auto capacity( ) const noexcept -> Size { return out_.capacity( ); }
+            bool overflow( ) const noexcept { return false; }
+            void push_back( Char value ) { out_.push_back( value ); }
+            void append( Char const *data, Size size ) { out_.append( data, size ); }
+            auto grow( Size size ) -> Char * {
+                auto const used = out_.size( );
+                out_.resize( used + size );
+                return out_.data( ) + used;
+            }
+        };
+        template< typename Data >
+        SinkString( Data &out ) -> SinkString< typename Data::value_type, Data >;
+        template< typename Char >
+        using SinkStream = SinkString< Char, std::basic_string< Char >, StatsShape::Stream >;
+        template< typename Char, StatsShape Shape_ = StatsShape::Span >
+        class SinkSpan {
+            Char *data_;
+            Size size_{ 0 };
+            Size capacity_;
+            bool overflow_{ false };
+        public:
+            static constexpr bool Bounded = true;
+            static constexpr StatsShape Shape = Shape_;
+            SinkSpan( Char *data, Size capacity ) noexcept : data_{ data }, capacity_{ capacity } { }
+            auto size( ) const noexcept -> Size { return size_; }
+            auto capacity( ) const noexcept -> Size { return capacity_; }
+            auto room( ) const noexcept -> Size { return capacity_ - size_; }
+            bool overflow( ) const noexcept { return overflow_; }
+            void push_back( Char value ) noexcept {
+                if ( size_ == capacity_ ) overflow_ = true;
+                else data_[size_++] = value;
+            }
+            void append( Char const *data, Size size ) noexcept {
+                if ( room( ) < size ) overflow_ = true;
+                else for ( Size i = 0; i < size; ++i ) data_[size_++] = data[i];
+            }
+            auto grow( Size size ) noexcept -> Char * {
+                if ( room( ) < size ) return overflow_ = true, nullptr;
+                auto const used = size_;
+                size_ += size;
+                return data_ + used;
+            }
+        };
+        template< typename Char >
+        class SinkCount {
+            Size size_{ 0 };
+        public:
+            static constexpr bool Bounded = false;
+            static constexpr StatsShape Shape = StatsShape::Size;
+            auto size( ) const noexcept -> Size { return size_; }
+            auto capacity( ) const noexcept -> Size { return 0; }
+            bool overflow( ) const noexcept { return false; }
+            void push_back( Char ) noexcept { ++size_; }
+            void append( Char const *, Size size ) noexcept { size_ += size; }
+            auto grow( Size size ) noexcept -> Char * { return size_ += size, nullptr; }
+        };
         // encode detail implementation and it helpers
-        // -- helpers
-        constexpr Encoded::In const Encode_Sumvolu_Plain_{ u"АБВГДЕЖЗИЙКЛМНОПРСТУФХЦЧШЩЬЮЯабвгдежзийклмнопрстуфхцчшщьюя" };
-        static_assert( check_sorted( Encode_Sumvolu_Plain_ ) && Encode_Sumvolu_Plain_.size( ) == 58 );
-        constexpr Encoded::In const Encode_Sumvolu_Mixed_{ u"ЁЄІЇЪЫЭъыэёєіїҐґ" };
-        static_assert( Encode_Sumvolu_Mixed_.size( ) == 16 );
-        template< unsigned Size >
-        using ArrayViewLetter = std::array< Encoded::View, Size >;
-        using ArrayPlain = ArrayViewLetter< Encode_Sumvolu_Plain_.size( ) >;
-        constexpr ArrayPlain const Encode_Letters_Plain_{{
-            // x is used to prepend english letters
-            // upper
-            "A", "B", "V", "G", "D", "E","JZ", "Z", // А,Б,В,Г,Д,Е,Ж,З
-            "U", "I", "K", "L", "M", "N", "O", "P", // И,Й,К,Л,М,Н,О,П
-            "R", "S", "T", "Y", "F", "H", "C","JC", // Р,С,Т,У,Ф,Х,Ц,Ч
-            "W","JW", "Q","JY","JA",                // Ш,Щ,Ь,Ю,Я
-            // lower
-            "a", "b", "v", "g", "d", "e","jz", "z", // а,б,в,г,д,е,ж,з
-            "u", "i", "k", "l", "m", "n", "o", "p", // и,й,к,л,м,н,о,п
-            "r", "s", "t", "y", "f", "h", "c","jc", // р,с,т,у,ф,х,ц,ч
-            "w","jw", "q","jy","ja",                // ш,щ,ь,ю,я
-        }};
-        using ArrayMixed = std::array< ArrayViewLetter< Encode_Sumvolu_Mixed_.size( ) >, 2 >;
-        constexpr ArrayMixed const Encode_Letters_Mixed_{{
-            //  Ё ,   Є ,   І ,   Ї ,   Ъ ,   Ы ,   Э ,   ъ ,   ы ,   э ,   ё ,   є ,   і ,   ї ,   Ґ ,   ґ
-            { "JI", "JE", "JU", "JI", "JQ", "JU", "JE", "jq", "ju", "je", "ji", "je", "ju", "ji", "JQ", "jq" },
-            {"JXV","JXE","JXI","JXY","JXQ","JXU","JXZ","jxq","jxu","jxz","jxv","jxe","jxi","jxy","JXG","jxg" },
-        }};
-        constexpr std::bitset< Encode_Sumvolu_Mixed_.size( ) > Letters_Mixed_Flags_{ 0b1111'1000'0000'1110 };
-        // -- implementation
+        // -- implementation, writes to sink and stops at first invalid unit
+        template< ValidateMode Mode, typename Sink, typename In >
         [[nodiscard]]
-        auto encode_impl( Encoded::Out out, Encoded::In in ) -> Error {
-            if ( this_thread::state_language( ) == Language::None ) return Error::Language;
-            Encoded::Data tmp;
-            tmp.reserve( in.size( ) );
-            auto find_plain = [&tmp]( auto word ) -> bool {
-                auto beg = Encode_Sumvolu_Plain_.begin( );
-                auto end = Encode_Sumvolu_Plain_.end( );
-                auto it = std::lower_bound( beg, end, word );
-                if ( it == end || *it != word ) return false;
-                tmp.append( Encode_Letters_Plain_[it - beg] );
+        auto encode_kernel( Sink &tmp, In in, Setting const &setting ) -> Result {
+            constexpr bool Utf8 = std::is_same_v< In, StringByteView >;
+            auto const language = setting.language;
+            auto const &table = Encode_Table_Cyrillic_[static_cast< unsigned >( language ) - 1u];
+            auto const &cache = setting.cache;
+            auto const validate = setting.validate;
+            auto const used = tmp.size( );
+            auto find_table = [&tmp]( EncodeGlyph const &glyph ) -> bool {
+                if ( glyph.size == 0 ) return false;
+                tmp.append( glyph.data.data( ), glyph.size );
                 return true;
             };
-            auto find_mixed = [&tmp]( auto word ) -> bool {
-                auto beg = Encode_Sumvolu_Mixed_.begin( );
-                auto end = Encode_Sumvolu_Mixed_.end( );
-                auto it = std::find( beg, end, word );
-                if ( it == end ) return false;
-                bool lang = static_cast< unsigned >( this_thread::state_language( ) ) - 1u;
-                auto col = it - beg;
-                auto row = Letters_Mixed_Flags_[col] != lang ? 1 : 0;
-                tmp.append( Encode_Letters_Mixed_[row][col] );
-                return true;
+            auto find_cyrillic = [&table,&find_table]( auto word ) -> bool {
+                if ( ( word >> 8u ) != Encode_Block_Cyrillic_ ) return false;
+                return find_table( table[word & 0xFFu] );
             };
-            auto find_latin = [&tmp]( auto word ) -> bool {
-                bool upper = 'A' <= word && word <= 'Z';
-                bool lower = 'a' <= word && word <= 'z';
-                if ( not ( upper || lower ) ) return false;
-                tmp.push_back( lower ? 'x' : 'X' );
-                tmp.push_back( static_cast< unsigned char >( word ) );
-                return true;
+            auto find_ascii = [&find_table]( auto word ) -> bool {
+                if ( word >= Encode_Ascii_Size_ ) return false;
+                return find_table( Encode_Table_Ascii_[word] );
             };
             auto find_other = [&tmp]( auto word ) -> bool {
                 if ( word >> 8u ) tmp.push_back( word >> 8u );
                 tmp.push_back( static_cast< unsigned char >( word ) );
                 return true;
             };
-            auto find_valid = [&tmp]( auto word ) -> bool {
+            // -- bulk copy of plain ascii run, cached limits run to appended symbols by mask built on first use
+            using Unit = std::make_unsigned_t< typename In::value_type >;
+            AsciiMask mask{ };
+            bool masked = false;
+            auto find_run = [&tmp,&cache,&mask,&masked,in]( Size index, bool cached ) -> Size {
+                if ( not ascii_plain( static_cast< Unit >( in[index] ) ) ) return 0;
+                auto const &simd = simd_kernels( );
+                auto const *from = in.data( ) + index;
+                auto const left = in.size( ) - index;
+                Size size;
+                if ( cached ) {
+                    if ( not cache.append( static_cast< Unit >( in[index] ) ) ) return 0;
+                    if ( not masked ) mask = ascii_mask_append( cache ), masked = true;
+                    if constexpr ( Utf8 ) size = ascii_run( from, left, mask, simd.mask_bytes );
+                    else size = ascii_run( from, left, mask, simd.mask_words );
+                } else {
+                    if constexpr ( Utf8 ) size = ascii_run< true >( from, left, simd.plain_bytes );
+                    else size = ascii_run< true >( from, left, simd.plain );
+                }
+                // -- bounded sink takes what fits, the rest overflows on single word path
+                if constexpr ( Sink::Bounded ) if ( tmp.room( ) < size ) size = tmp.room( );
+                if ( size == 0 ) return 0;
+                auto *data = tmp.grow( size );
+                if ( not data ) return size;
+                if constexpr ( Utf8 ) std::memcpy( data, from, size );
+                else ascii_copy( data, from, size, simd.narrow );
+                return size;
+            };
+            auto find_valid = [&tmp,&cache,validate,&find_table]( auto word ) -> bool {
                 auto const charHi = static_cast< unsigned char >( word >> 8u );
                 auto const charLo = static_cast< unsigned char >( word );
                 if ( charHi ) {
-                    bool const ignore = validate_ignore{ }( ValidateFlags::Wide_Bytes );
-                    bool const append = validate_append{ }( ValidateFlags::Wide_Bytes );
+                    bool const ignore = validate_ignore{ }( validate, ValidateFlags::Wide_Bytes );
+                    bool const append = validate_append{ }( validate, ValidateFlags::Wide_Bytes );
                     if ( not ignore and not append ) return false;
                     if ( append ) {
                         tmp.push_back( charHi );
@@ -284,173 +810,510 @@ namespace son8::cyrillic {
                     }
                     return true;
                 } else if ( 0x80u <= charLo ) {
-                    bool const ignore = validate_ignore{ }( ValidateFlags::Ascii_Bytes_Extended );
-                    bool const append = validate_append{ }( ValidateFlags::Ascii_Bytes_Extended );
+                    bool const ignore = validate_ignore{ }( validate, ValidateFlags::Ascii_Bytes_Extended );
+                    bool const append = validate_append{ }( validate, ValidateFlags::Ascii_Bytes_Extended );
                     if ( not ignore and not append ) return false;
                     if ( append ) tmp.push_back( charLo );
                     return true;
                 } else {
-                    auto const [append,ignore] = ValidateFlagCache_.ai_pair( charLo );
+                    auto const [append,ignore] = cache.ai_pair( charLo );
                     if ( not ignore and not append ) return false;
-                    if ( append ) {
-                        if/*_*/ ( 'a' <= charLo && charLo <= 'z' ) tmp.push_back( 'x' );
-                        else if ( 'A' <= charLo && charLo <= 'Z' ) tmp.push_back( 'X' );
-                        tmp.push_back( charLo );
-                    }
+                    if ( append ) find_table( Encode_Table_Ascii_[charLo] );
                     return true;
                 }
                 return true;
             };
+            // -- run is number of code units consumed by bulk copy, zero when word handled alone
+            auto find_word = [&]( Unt2 word, Size index, Size &run ) -> bool {
+                // true Success, false Failure
+                if ( find_cyrillic( word ) ) return true;
+                if constexpr ( Mode == ValidateMode::None ) return false;
+                if constexpr ( Mode == ValidateMode::IgnoreAll ) return true;
+                if constexpr ( Mode == ValidateMode::AppendAll ) {
+                    if ( ( run = find_run( index, false ) ) ) return true;
+                    if ( find_ascii( word ) ) return true;
+                    return find_other( word );
+                }
+                if constexpr ( Mode == ValidateMode::Custom ) {
+                    if ( ( run = find_run( index, true ) ) ) return true;
+                    return find_valid( word );
+                }
+            };
 
-            for ( Unt2 word : in ) {
-                // continue Success, break Failure
-                if ( find_plain( word ) ) continue;
-                if ( find_mixed( word ) ) continue;
-                switch ( this_thread::state_validate( ) ) {
-                case Validate::None: break;
-                case Validate::IgnoreAll: continue;
-                case Validate::AppendAll: {
-                    if ( find_latin( word ) ) continue;
-                    if ( find_other( word ) ) continue;
-                    break;
-                }
-                default: {
-                    if ( find_valid( word ) ) continue;
-                    break;
-                }}
-                return Error::InvalidWord;
+            // -- written counts output of fully consumed units only
+            for ( Size i = 0; i < in.size( ); ) {
+                Size run = 0;
+                auto const from = i;
+                auto const before = tmp.size( );
+                bool found;
+                if constexpr ( Utf8 ) {
+                    auto const point = utf8_next( in, i );
+                    if ( point == Utf8_Invalid_ ) return Result{ Error::ConvertFailed, from, before - used };
+                    if ( point < Utf16_Supplementary_ ) found = find_word( point, from, run );
+                    else {
+                        auto const [hi,lo] = utf16_surrogates( point );
+                        found = find_word( hi, from, run ) && find_word( lo, from, run );
+                    }
+                    if ( run ) i = from + run;
+                } else {
+                    found = find_word( in[i], i, run );
+                    i += run ? run : 1;
+                }
+                if ( not found ) return Result{ Error::InvalidWord, from, before - used };
+                if constexpr ( Sink::Bounded ) if ( tmp.overflow( ) ) return Result{ Error::OutputOverflow, from, before - used };
+            }
+            return Result{ Error::None, in.size( ), tmp.size( ) - used };
+        }
+        // -- validate read once per call to pick specialized kernel
+        template< typename Sink, typename In >
+        [[nodiscard]]
+        auto encode_kernel( Sink tmp, In in, Setting const &setting ) -> Result {
+            if ( setting.language == Language::None ) return Result{ Error::Language, 0, 0 };
+            assert( setting.language < Language::Size_ );
+            switch ( setting.validate ) {
+            case Validate::None: return encode_kernel< ValidateMode::None >( tmp, in, setting );
+            case Validate::IgnoreAll: return encode_kernel< ValidateMode::IgnoreAll >( tmp, in, setting );
+            case Validate::AppendAll: return encode_kernel< ValidateMode::AppendAll >( tmp, in, setting );
+            default: return encode_kernel< ValidateMode::Custom >( tmp, in, setting );
             }
+        }
+        // -- every encode reaches kernels through here, so call is counted once
+        template< typename Sink, typename In >
+        [[nodiscard]]
+        auto encode_core( Sink tmp, In in, Setting const &setting ) -> Result {
+            auto const capacity = tmp.capacity( );
+            auto const result = encode_kernel( tmp, in, setting );
+            stats_call( StatsKind::Encode, Sink::Shape, in, result.written, result.code );
+            if ( tmp.capacity( ) != capacity ) stats_allocation( );
+            return result;
+        }
+        template< typename Data, typename In >
+        [[nodiscard]]
+        auto encode_impl( Data &out, In in, Setting const &setting ) -> Error {
+            using Sink = SinkString< typename Data::value_type, Data, StatsShape::String >;
+            Data tmp{ out.get_allocator( ) };
+            tmp.reserve( in.size( ) );
+            if ( tmp.capacity( ) ) stats_allocation( );
+            auto const result = encode_core( Sink{ tmp }, in, setting );
+            if ( not result ) return result.code;
             // return
             // -- if size equal capacity user possibly expect data to be shrink
             // -- or can force to not shrinking it providing out with capacity
             // -- TODO document this behavior into root README
-            if ( out.size( ) == out.capacity( ) ) tmp.shrink_to_fit( );
+            if ( out.size( ) == out.capacity( ) ) tmp.shrink_to_fit( ), stats_shrink( );
             out = std::move( tmp );
             return Error::None;
         }
+        template< typename Data, typename In >
+        [[nodiscard]]
+        auto encode_impl( Data &out, In in ) -> Error { return encode_impl( out, in, setting_thread( ) ); }
         // decode detail implementation and it helpers
-        // -- detail helpers
-        constexpr Decoded::In   Decode_Letters_Plain_{ "ABCDEFGHIKLMNOPQRSTUVWYZabcdefghiklmnopqrstuvwyz" };
-        static_assert( check_sorted( Decode_Letters_Plain_ ) );
-        constexpr Decoded::View Decode_Sumvolu_Plain_{u"АБЦДЕФГХЙКЛМНОПЬРСТИВШУЗабцдефгхйклмнопьрстившуз" };
-        static_assert( Decode_Letters_Plain_.size( ) == Decode_Sumvolu_Plain_.size( ) );
-        using ArrayViewDecodeLetters = std::array< Decoded::In, 4 >;
-        // TODO maybe do also 8 to map 1to1, and change order of elements for
-        //      most popular ones for each entry to improve find performances
-        constexpr ArrayViewDecodeLetters const Decode_Letters_Mixed_{{
-            "zcwyaeiuq",
-            "ZCWYAEIUQ",
-            "quzveiyg",
-            "VEIYQUZG",
-        }};
-        using ArrayViewDecodeSumvolu = std::array< Decoded::View, 8 >;
-        constexpr ArrayViewDecodeSumvolu const Decode_Sumvolu_Mixed_{{
-           u"жчщюяэёыъ",// ru jj lower
-           u"ЖЧЩЮЯЭЁЫЪ",// ru jj upper
-           u"ъыэёєіїґ", // ru jx lower
-           u"ЁЄІЇЪЫЭҐ", // ru jx upper
-           u"жчщюяєїіґ",// ua jj lower
-           u"ЖЧЩЮЯЄЇІҐ",// ua jj upper
-           u"ъыэёєіїґ", // ua jx lower
-           u"ЁЄІЇЪЫЭҐ", // ua jx upper
-        }};
-        enum class DecodedState : unsigned {
-            Defaults,
-            Lower_JJ,
-            Upper_JJ,
-            Lower_JX,
-            Upper_JX,
-            Pusher_8,
-            Error_DS,
-        };
         // -- detail implementation
+        // -- decoded letters are all below U+0800, so utf-8 sink gets two bytes each
+        template< typename Sink >
+        void decode_push( Sink &sink, char16_t word, char ) {
+            assert( word < 0x800u );
+            char const bytes[2]{ static_cast< char >( 0xC0u | ( word >> 6u ) ), static_cast< char >( 0x80u | ( word & 0x3Fu ) ) };
+            sink.append( bytes, 2 );
+        }
+        template< typename Sink >
+        void decode_push( Sink &sink, char16_t word, char16_t ) { sink.push_back( word ); }
+        // -- sink of char16_t or utf-8 char, state carries between calls, last rejects unfinished sequence
+        template< typename Char, typename Sink >
         [[nodiscard]]
-        auto decode_impl( Decoded::Out out, Decoded::In in ) -> Error {
+        auto decode_kernel( Sink tmp, Decoded::In in, Setting const &setting, DecodedState &state, bool last ) -> Result {
             using State = DecodedState;
-            if ( this_thread::state_language( ) == Language::None ) return Error::Language;
-            Decoded::Data tmp;
-            auto ali = 0; // array letter index
-            auto const asi = ( this_thread::state_language( ) == Language::Ukrainian ) ? 4 : 0; // array sumvol index
-            auto state = DecodedState::Defaults;
-            // lambdas
-            auto process_defaults = [&tmp]( auto byte ) -> State {
-                if ( byte == 'j' ) return State::Lower_JJ;
-                if ( byte == 'J' ) return State::Upper_JJ;
-                auto beg = Decode_Letters_Plain_.begin( );
-                auto end = Decode_Letters_Plain_.end( );
-                auto it = std::lower_bound( beg, end, byte );
-                if ( it == end || *it != byte ) return State::Error_DS;
-                tmp.push_back( Decode_Sumvolu_Plain_[it - beg] );
-                return State::Defaults;
-            };
-            auto process_lower_jj = [&ali]( auto byte ) -> State {
-                if ( byte == 'x' ) return State::Lower_JX;
-                ali = 0;
-                return State::Pusher_8;
-            };
-            auto process_upper_jj = [&ali]( auto byte ) -> State {
-                if ( byte == 'X' ) return State::Upper_JX;
-                ali = 1;
-                return State::Pusher_8;
-            };
-            auto process_lower_jx = [&ali]( ) -> State {
-                ali = 2;
-                return State::Pusher_8;
-            };
-            auto process_upper_jx = [&ali]( ) -> State {
-                ali = 3;
-                return State::Pusher_8;
-            };
-            auto pusher_8 = [&ali,asi,&tmp]( auto byte ) -> State {
-                auto &searched = Decode_Letters_Mixed_[ali];
-                auto beg = searched.begin( );
-                auto end = searched.end( );
-                auto it = std::find( beg, end, byte );
-                if ( it == end ) return State::Error_DS;
-                auto &replaced = Decode_Sumvolu_Mixed_[ali + asi];
-                tmp.push_back( replaced[it - beg] );
-                return State::Defaults;
-            };
+            auto const language = setting.language;
+            if ( language == Language::None ) return Result{ Error::Language, 0, 0 };
+            auto const &table = Decode_Table_[language == Language::Ukrainian];
+            auto const used = tmp.size( );
+            Size start = 0; // first byte of current sequence
             // process
-            for ( auto byte : in ) {
-                switch ( state ) {
-                    case State::Defaults: state = process_defaults( byte ); break;
-                    case State::Lower_JJ: state = process_lower_jj( byte ); break;
-                    case State::Upper_JJ: state = process_upper_jj( byte ); break;
-                    case State::Lower_JX: state = process_lower_jx( ); break;
-                    case State::Upper_JX: state = process_upper_jx( ); break;
-                    case State::Pusher_8: assert( false && "should not ever reach this" ); [[fallthrough]];
-                    case State::Error_DS: [[fallthrough]];
-                    default: return Error::InvalidByte;
-                }
-                if ( state == State::Pusher_8 ) state = pusher_8( byte );
-            }
-            if ( state != State::Defaults ) return Error::InvalidByte;
+            for ( Size i = 0; i < in.size( ); ++i ) {
+                auto const step = table[static_cast< unsigned >( state )][static_cast< Unt0 >( in[i] )];
+                if ( state == State::Defaults ) start = i;
+                if ( step.next == State::Error_DS ) return Result{ Error::InvalidByte, start, tmp.size( ) - used };
+                if ( step.word ) {
+                    auto const before = tmp.size( );
+                    decode_push( tmp, step.word, Char{ } );
+                    if constexpr ( Sink::Bounded ) if ( tmp.overflow( ) ) return Result{ Error::OutputOverflow, start, before - used };
+                }
+                state = step.next;
+            }
+            if ( last && state != State::Defaults ) return Result{ Error::InvalidByte, start, tmp.size( ) - used };
+            return Result{ Error::None, in.size( ), tmp.size( ) - used };
+        }
+        // -- every decode reaches kernel through here, so call is counted once
+        template< typename Char, typename Sink >
+        [[nodiscard]]
+        auto decode_core( Sink tmp, Decoded::In in, Setting const &setting, DecodedState &state, bool last ) -> Result {
+            auto const capacity = tmp.capacity( );
+            auto const result = decode_kernel< Char >( tmp, in, setting, state, last );
+            stats_call( StatsKind::Decode, Sink::Shape, in, result.written * sizeof( Char ), result.code );
+            if ( tmp.capacity( ) != capacity ) stats_allocation( );
+            return result;
+        }
+        template< typename Data >
+        [[nodiscard]]
+        auto decode_impl( Data &out, Decoded::In in, Setting const &setting ) -> Error {
+            using Char = typename Data::value_type;
+            Data tmp{ out.get_allocator( ) };
+            auto state = DecodedState::Defaults;
+            auto const result = decode_core< Char >( SinkString< Char, Data, StatsShape::String >{ tmp }, in, setting, state, true );
+            if ( not result ) return result.code;
             // return
             // -- if size equal capacity user possibly expect data to be shrink
             // -- or can force to not shrinking it providing out with capacity
             // -- TODO document this behavior into root README
-            if ( out.size( ) == out.capacity( ) ) tmp.shrink_to_fit( );
+            if ( out.size( ) == out.capacity( ) ) tmp.shrink_to_fit( ), stats_shrink( );
             out = std::move( tmp );
             return Error::None;
         }
+        template< typename Data >
+        [[nodiscard]]
+        auto decode_impl( Data &out, Decoded::In in ) -> Error { return decode_impl( out, in, setting_thread( ) ); }
+        // -- streaming helper, decoded state kept by caller between chunks, dropped on failure
+        template< typename Data >
+        [[nodiscard]]
+        auto decode_feed( Data &sink, Decoded::In chunk, Language language, Unt0 &state ) -> Error {
+            using Char = typename Data::value_type;
+            CharFlagCache const cache;
+            auto decoded = static_cast< DecodedState >( state );
+            auto const result = decode_core< Char >( SinkStream< Char >{ sink }, chunk, Setting{ language, Validate::None, cache }, decoded, false );
+            state = static_cast< Unt0 >( result.code == Error::None ? decoded : DecodedState::Defaults );
+            return result.code;
+        }
+        // check detail implementation
+        // -- classification part of encode kernel, nothing is written
+        template< ValidateMode Mode >
+        auto encode_accept( Unt2 word, ArrayGlyphCyrillic const &table, Setting const &setting ) -> bool {
+            if ( ( word >> 8u ) == Encode_Block_Cyrillic_ && table[word & 0xFFu].size ) return true;
+            if constexpr ( Mode == ValidateMode::None ) return false;
+            else if constexpr ( Mode == ValidateMode::Custom ) {
+                auto const charHi = word >> 8u;
+                auto const charLo = static_cast< Unt0 >( word );
+                if ( charHi || 0x80u <= charLo ) {
+                    auto const flag = charHi ? ValidateFlags::Wide_Bytes : ValidateFlags::Ascii_Bytes_Extended;
+                    return validate_append{ }( setting.validate, flag ) || validate_ignore{ }( setting.validate, flag );
+                }
+                auto const [append,ignore] = setting.cache.ai_pair( charLo );
+                return append || ignore;
+            }
+            else return true;
+        }
+        // -- rejected units, first stops at first one, utf-8 input is only checked up to first failure
+        template< ValidateMode Mode, typename In >
+        auto encode_reject( In in, Setting const &setting, bool first ) -> Size {
+            constexpr bool Utf8 = std::is_same_v< In, StringByteView >;
+            if constexpr ( not Utf8 && ( Mode == ValidateMode::IgnoreAll || Mode == ValidateMode::AppendAll ) ) return 0;
+            auto const &table = Encode_Table_Cyrillic_[static_cast< unsigned >( setting.language ) - 1u];
+            Size count = 0;
+            for ( Size i = 0; i < in.size( ); ) {
+                if constexpr ( Utf8 ) {
+                    // -- rejected code point is skipped whole, malformed byte alone
+                    auto const point = utf8_next( in, i );
+                    bool accept = false;
+                    if/*_*/ ( point == Utf8_Invalid_ ) ++i;
+                    else if ( point < Utf16_Supplementary_ ) accept = encode_accept< Mode >( point, table, setting );
+                    else {
+                        auto const [hi,lo] = utf16_surrogates( point );
+                        accept = encode_accept< Mode >( hi, table, setting ) && encode_accept< Mode >( lo, table, setting );
+                    }
+                    count += not accept;
+                } else count += not encode_accept< Mode >( in[i++], table, setting );
+                if ( first && count ) return count;
+            }
+            return count;
+        }
+        template< typename In >
+        auto encode_reject( In in, Setting const &setting, bool first ) -> Size {
+            stats_call( StatsKind::Encode, StatsShape::Check, in, 0, Error::None );
+            if ( setting.language == Language::None ) {
+                if constexpr ( std::is_same_v< In, StringByteView > ) if ( not first ) return utf8_units( in );
+                return first ? 1 : in.size( );
+            }
+            switch ( setting.validate ) {
+            case Validate::None: return encode_reject< ValidateMode::None >( in, setting, first );
+            case Validate::IgnoreAll: return encode_reject< ValidateMode::IgnoreAll >( in, setting, first );
+            case Validate::AppendAll: return encode_reject< ValidateMode::AppendAll >( in, setting, first );
+            default: return encode_reject< ValidateMode::Custom >( in, setting, first );
+            }
+        }
+        // -- transitions of decode kernel only, count matches resuming one byte past each failed sequence start
+        auto decode_reject( Decoded::In in, Setting const &setting, bool first ) -> Size {
+            using State = DecodedState;
+            stats_call( StatsKind::Decode, StatsShape::Check, in, 0, Error::None );
+            if ( setting.language == Language::None ) return first ? 1 : in.size( );
+            auto const &table = Decode_Table_[setting.language == Language::Ukrainian];
+            auto state = State::Defaults;
+            Size count = 0;
+            Size start = 0;
+            auto const &defaults = table[static_cast< unsigned >( State::Defaults )];
+            for ( Size i = 0; i < in.size( ); ) {
+                if ( state == State::Defaults ) {
+                    // -- plain letters keep default state, skipped without dependency on previous step
+                    while ( i < in.size( ) && defaults[static_cast< Unt0 >( in[i] )].next == State::Defaults ) ++i;
+                    if ( i == in.size( ) ) break;
+                    start = i;
+                }
+                state = table[static_cast< unsigned >( state )][static_cast< Unt0 >( in[i++] )].next;
+                if ( state == State::Error_DS || ( i == in.size( ) && state != State::Defaults ) ) {
+                    if ( first ) return 1;
+                    ++count;
+                    i = start + 1;
+                    state = State::Defaults;
+                }
+            }
+            return count;
+        }
+        // resume detail implementation
+        // -- call gets rest of input from offset, read is reported as offset into whole input
+        template< typename View, typename Call >
+        auto resume_impl( View in, Size from, Call call ) -> Result {
+            if ( from > in.size( ) ) from = in.size( );
+            auto result = call( in.substr( from ) );
+            result.read += from;
+            return result;
+        }
+        // batch detail implementation
+        // -- one reservation and one settings read per batch, failed row is rolled back to empty range
+        template< typename Char, typename In, typename Core >
+        auto batch_impl( Column< Char > &out, In const *in, Size size, Core core ) -> Size {
+            Size reserve = out.data.size( );
+            for ( Size i = 0; i < size; ++i ) reserve += in[i].size( );
+            out.data.reserve( reserve );
+            out.offsets.reserve( out.offsets.size( ) + size );
+            out.errors.reserve( out.errors.size( ) + size );
+            Size failed = 0;
+            for ( Size i = 0; i < size; ++i ) {
+                auto const used = out.data.size( );
+                auto const result = core( SinkString< Char, std::basic_string< Char >, StatsShape::Batch >{ out.data }, in[i] );
+                if ( not result ) out.data.resize( used ), ++failed;
+                out.offsets.push_back( out.data.size( ) );
+                out.errors.push_back( result.code );
+            }
+            return failed;
+        }
+        // parallel detail implementation
+        // -- one batch per call, indices claimed under pool mutex by workers and calling thread alike
+        struct ParallelBatch {
+            void ( *run )( void *task, Size index );
+            void *task;
+            Size count;
+            Size next{ 0 };
+            Size done{ 0 };
+        };
+        // -- workers started on demand and kept for process lifetime, so calls after first spawn nothing
+        class ParallelPool {
+            std::mutex mutex_;
+            std::condition_variable wake_;
+            std::condition_variable idle_;
+            std::deque< ParallelBatch * > queue_;
+            Size workers_{ 0 };
+            // -- caller holds lock, batch leaves queue once its last index is claimed
+            auto claim( ParallelBatch &batch ) -> Size {
+                auto const index = batch.next++;
+                if ( batch.next == batch.count ) queue_.erase( std::find( queue_.begin( ), queue_.end( ), &batch ) );
+                return index;
+            }
+            void finish( std::unique_lock< std::mutex > &lock, ParallelBatch &batch, Size index ) {
+                lock.unlock( );
+                batch.run( batch.task, index );
+                lock.lock( );
+                if ( ++batch.done == batch.count ) idle_.notify_all( );
+            }
+            void work( ) {
+                std::unique_lock< std::mutex > lock{ mutex_ };
+                for ( ;; ) {
+                    wake_.wait( lock, [this] { return not queue_.empty( ); } );
+                    auto &batch = *queue_.front( );
+                    finish( lock, batch, claim( batch ) );
+                }
+            }
+        public:
+            void run( ParallelBatch &batch ) {
+                std::unique_lock< std::mutex > lock{ mutex_ };
+                for ( ; workers_ + 1 < batch.count; ++workers_ ) std::thread{ [this] { work( ); } }.detach( );
+                queue_.push_back( &batch );
+                wake_.notify_all( );
+                // -- calling thread takes indices of own batch too, so progress never waits on busy workers
+                while ( batch.next < batch.count ) finish( lock, batch, claim( batch ) );
+                idle_.wait( lock, [&batch] { return batch.done == batch.count; } );
+            }
+        };
+        auto parallel_pool( ) -> ParallelPool & {
+            static auto *pool = new ParallelPool; // leaked, detached workers may outlive static destructors
+            return *pool;
+        }
+        // -- runs task for every index on pooled threads, calling thread included
+        template< typename Task >
+        void parallel_run( Size count, Task task ) {
+            std::vector< std::exception_ptr > errors( count );
+            auto guarded = [&task,&errors]( Size index ) {
+                try { task( index ); } catch ( ... ) { errors[index] = std::current_exception( ); }
+            };
+            using Guarded = decltype( guarded );
+            ParallelBatch batch{ []( void *task, Size index ) { ( *static_cast< Guarded * >( task ) )( index ); }, &guarded, count };
+            parallel_pool( ).run( batch );
+            for ( auto &error : errors ) if ( error ) std::rethrow_exception( error );
+        }
+        // -- chunk bounds, each split moved forward until safe returns true for it
+        template< typename Safe >
+        auto parallel_bounds( Size size, Parallel parallel, Safe safe ) -> std::vector< Size > {
+            Size const threads = parallel.threads ? parallel.threads : std::thread::hardware_concurrency( );
+            Size const minimal = parallel.chunk ? parallel.chunk : 1;
+            auto count = size / minimal;
+            if ( count > threads ) count = threads;
+            if ( count == 0 ) count = 1;
+            std::vector< Size > bounds{ 0 };
+            for ( Size i = 1; i < count; ++i ) {
+                auto bound = size / count * i;
+                if ( bound < bounds.back( ) ) bound = bounds.back( );
+                while ( bound < size && not safe( bound ) ) ++bound;
+                bounds.push_back( bound );
+            }
+            bounds.push_back( size );
+            return bounds;
+        }
+        // -- chunks transliterated into own parts, then stitched by offsets from prefix sum of part sizes
+        template< typename Char, typename Core >
+        [[nodiscard]]
+        auto parallel_impl( std::basic_string< Char > &out, std::vector< Size > const &bounds, Core core ) -> Error {
+            using Data = std::basic_string< Char >;
+            using Sink = SinkString< Char, Data, StatsShape::Parallel >;
+            auto const count = bounds.size( ) - 1;
+            if ( count == 1 ) {
+                Data tmp;
+                auto const result = core( Sink{ tmp }, bounds[0], bounds[1] );
+                if ( not result ) return result.code;
+                out = std::move( tmp );
+                return Error::None;
+            }
+            std::vector< Data > parts( count );
+            std::vector< Result > results( count );
+            parallel_run( count, [&]( Size i ) { results[i] = core( Sink{ parts[i] }, bounds[i], bounds[i + 1] ); } );
+            for ( auto const &result : results ) if ( not result ) return result.code;
+            std::vector< Size > offsets( count + 1, 0 );
+            for ( Size i = 0; i < count; ++i ) offsets[i + 1] = offsets[i] + parts[i].size( );
+            // -- stitching is memory bound, one pass on calling thread, first part reused as destination
+            Data tmp = std::move( parts[0] );
+            tmp.resize( offsets.back( ) );
+            for ( Size i = 1; i < count; ++i ) parts[i].copy( tmp.data( ) + offsets[i], parts[i].size( ) );
+            out = std::move( tmp );
+            return Error::None;
+        }
+        // -- encoded sequence never starts right after 'j' or 'jx' prefix
+        constexpr auto decode_prefix( char byte ) -> bool { return byte == 'j' || byte == 'J'; }
+        constexpr auto decode_resync( Decoded::In in, Size bound ) -> bool {
+            if ( decode_prefix( in[bound - 1] ) ) return false;
+            if ( bound < 2 ) return true;
+            return not ( ( in[bound - 1] == 'x' || in[bound - 1] == 'X' ) && decode_prefix( in[bound - 2] ) );
+        }
+        template< typename Data >
+        [[nodiscard]]
+        auto decode_parallel( Data &out, Decoded::In in, Parallel parallel ) -> Error {
+            using Char = typename Data::value_type;
+            auto const setting = setting_thread( );
+            auto const bounds = parallel_bounds( in.size( ), parallel, [in]( Size bound ) { return decode_resync( in, bound ); } );
+            return parallel_impl( out, bounds, [&setting,in]( auto sink, Size from, Size to ) {
+                auto state = DecodedState::Defaults;
+                return decode_core< Char >( sink, in.substr( from, to - from ), setting, state, true );
+            } );
+        }
         // convert detail implementation
+        // -- measure validates whole input and counts output units, so out is allocated once
+        [[nodiscard]] auto convert_measure( StringByteView in, Result &result ) -> bool {
+            auto const &simd = simd_kernels( );
+            for ( Size i = 0; i < in.size( ); ) {
+                if ( static_cast< Unt0 >( in[i] ) < 0x80u ) {
+                    auto const run = ascii_run< false >( in.data( ) + i, in.size( ) - i, simd.bytes );
+                    i += run, result.written += run;
+                    continue;
+                }
+                if ( utf8_pair( in, i ) ) {
+                    i += 2, result.written += 1;
+                    continue;
+                }
+                auto const from = i;
+                auto const point = utf8_next( in, i );
+                if ( point == Utf8_Invalid_ ) {
+                    result = Result{ Error::ConvertFailed, from, 0 };
+                    return false;
+                }
+                result.written += ( point < Utf16_Supplementary_ ) ? 1 : 2;
+            }
+            result.read = in.size( );
+            return true;
+        }
+        [[nodiscard]] auto convert_measure( StringWordView in, Result &result ) -> bool {
+            // -- branch-light count, surrogate pair counted as two three byte units then corrected
+            for ( Size i = 0; i < in.size( ); ++i ) {
+                Unt2 const word = in[i];
+                result.written += 1u + ( word >= 0x80u ) + ( word >= 0x800u );
+                if ( ( word & 0xF800u ) != 0xD800u ) continue;
+                if ( word < 0xDC00u && i + 1 < in.size( ) && ( in[i + 1] & 0xFC00u ) == 0xDC00u ) {
+                    result.written += 1, ++i;
+                    continue;
+                }
+                result = Result{ Error::ConvertFailed, i, 0 };
+                return false;
+            }
+            result.read = in.size( );
+            return true;
+        }
+        // -- fill assumes input already validated by measure
+        void convert_fill( char16_t *out, StringByteView in ) {
+            auto const &simd = simd_kernels( );
+            for ( Size i = 0; i < in.size( ); ) {
+                if ( static_cast< Unt0 >( in[i] ) < 0x80u ) {
+                    auto const run = ascii_run< false >( in.data( ) + i, in.size( ) - i, simd.bytes );
+                    ascii_copy( out, in.data( ) + i, run, simd.widen );
+                    i += run, out += run;
+                    continue;
+                }
+                if ( utf8_pair( in, i ) ) {
+                    *out++ = static_cast< char16_t >( ( ( in[i] & 0x1Fu ) << 6u ) | ( in[i + 1] & 0x3Fu ) );
+                    i += 2;
+                    continue;
+                }
+                auto const point = utf8_next( in, i );
+                if ( point < Utf16_Supplementary_ ) *out++ = static_cast< char16_t >( point );
+                else {
+                    auto const [hi,lo] = utf16_surrogates( point );
+                    *out++ = hi, *out++ = lo;
+                }
+            }
+        }
+        void convert_fill( char *out, StringWordView in ) {
+            auto const &simd = simd_kernels( );
+            for ( Size i = 0; i < in.size( ); ++i ) {
+                Unt2 point = in[i];
+                if ( point < 0x80u ) {
+                    auto const run = ascii_run< false >( in.data( ) + i, in.size( ) - i, simd.words );
+                    ascii_copy( out, in.data( ) + i, run, simd.narrow );
+                    i += run - 1, out += run;
+                    continue;
+                }
+                if ( point < 0x800u ) {
+                    *out++ = static_cast< char >( 0xC0u | ( point >> 6u ) );
+                    *out++ = static_cast< char >( 0x80u | ( point & 0x3Fu ) );
+                    continue;
+                }
+                if ( 0xD800u <= point && point <= 0xDBFFu ) point = Utf16_Supplementary_ + ( ( point - 0xD800u ) << 10u ) + ( in[++i] - 0xDC00u );
+                out = utf8_write( out, point );
+            }
+        }
         // -- convert
         template< typename Out, typename In >
-        [[nodiscard]] auto convert_impl( Out &out, In in ) -> Error {
-            if ( in.empty( ) ) {
-                out.clear( );
-                return Error::None;
-            }
-            using Converter = std::wstring_convert< std::codecvt_utf8_utf16< char16_t >, char16_t >;
-            Converter converter{ "", u"" };
+        [[nodiscard]] auto convert_impl( Out &out, In in ) -> Result {
             constexpr auto OutSize = sizeof( typename Out::value_type );
             constexpr auto InSize = sizeof( typename In::value_type );
             static_assert( OutSize != InSize, "son8::cyrillic convert requires value types with different sizes" );
-            if constexpr ( OutSize < InSize ) out = converter.to_bytes( in.data( ), in.data( ) + in.size( ) );
-            else                              out = converter.from_bytes( in.data( ), in.data( ) + in.size( ) );
-            if ( out.empty( ) ) return Error::ConvertFailed;
-            return Error::None;
+            Result result;
+            if ( not convert_measure( in, result ) ) return result;
+            out.resize( result.written );
+            convert_fill( out.data( ), in );
+            return result;
         }
         // validate detail implementation
         // -- flag
@@ -466,8 +1329,8 @@ namespace son8::cyrillic {
             if/*_*/ constexpr ( Append and not Ignore ) value |= bitHi, value &=~bitLo;
             else if constexpr ( Ignore and not Append ) value &=~bitHi, value |= bitLo;
             else value &= ~( bitHi | bitLo );
-            char_flag_cache_update< Append, Ignore >( flag );
-            this_thread::state( static_cast< Validate >( value ) );
+            char_flag_cache_update< Append, Ignore >( ValidateFlagCache_, flag );
+            Validate_ = static_cast< Validate >( value );
         }
         // error implementation
         // -- throw only if error is non-zero
@@ -483,14 +1346,299 @@ namespace son8::cyrillic {
             "son8::cyrillic: invalid byte",
             "son8::cyrillic: convert failed",
             "son8::cyrillic: validate misconfigured",
+            "son8::cyrillic: output overflow",
+        }};
+        // search detail implementation
+        // -- encoded unit length, j and J open two or three byte sequence, x and X prefix appended letter
+        auto encoded_unit( StringByteView in, Size at ) noexcept -> Size {
+            auto const byte = in[at];
+            auto const lower = static_cast< char >( byte | 0x20 );
+            if ( lower != 'j' && lower != 'x' ) return 1;
+            Size size = 2;
+            if ( lower == 'j' && at + 1 < in.size( ) && in[at + 1] == ( byte == 'j' ? 'x' : 'X' ) ) size = 3;
+            auto const left = in.size( ) - at;
+            return size < left ? size : left;
+        }
+        // detect tables
+        // -- mark of language using letter, mixed letters are exactly letters found in one language only
+        enum class DetectMark : Unt0 {
+            None,
+            Russian,
+            Ukrainian,
+            Ambiguous, // encoded j sequence read differently per language
+        };
+        using ArrayDetectMark = std::array< DetectMark, 256 >;
+        // -- indexed by low byte of word from cyrillic block
+        constexpr auto detect_table_words( ) -> ArrayDetectMark {
+            ArrayDetectMark table{ };
+            for ( Size col = 0; col < Encode_Sumvolu_Mixed_.size( ); ++col ) {
+                table[Encode_Sumvolu_Mixed_[col] & 0xFFu] = Letters_Mixed_Flags_[col] ? DetectMark::Ukrainian : DetectMark::Russian;
+            }
+            return table;
+        }
+        constexpr ArrayDetectMark const Detect_Table_Words_{ detect_table_words( ) };
+        // -- indexed by letter after jx and JX prefix, letter of other language is written that way
+        // -- then by letter after j and J prefix, where both languages decode to different words
+        constexpr auto detect_table_encoded( bool prefix_x ) -> ArrayDetectMark {
+            ArrayDetectMark table{ };
+            for ( auto upper = 0; upper < 2; ++upper ) {
+                if ( prefix_x ) {
+                    auto const letters = Decode_Letters_Mixed_[2 + upper];
+                    auto const sumvolu = Decode_Sumvolu_Mixed_[2 + upper];
+                    for ( Size i = 0; i < letters.size( ); ++i ) {
+                        auto const mark = Detect_Table_Words_[sumvolu[i] & 0xFFu];
+                        table[static_cast< Unt0 >( letters[i] )] = mark == DetectMark::Russian ? DetectMark::Ukrainian : DetectMark::Russian;
+                    }
+                } else {
+                    auto const letters = Decode_Letters_Mixed_[upper];
+                    for ( Size i = 0; i < letters.size( ); ++i ) {
+                        if ( Decode_Sumvolu_Mixed_[upper][i] != Decode_Sumvolu_Mixed_[4 + upper][i] ) {
+                            table[static_cast< Unt0 >( letters[i] )] = DetectMark::Ambiguous;
+                        }
+                    }
+                }
+            }
+            return table;
+        }
+        constexpr ArrayDetectMark const Detect_Table_Encoded_J_{ detect_table_encoded( false ) };
+        constexpr ArrayDetectMark const Detect_Table_Encoded_JX_{ detect_table_encoded( true ) };
+        // detect detail implementation
+        struct DetectCount {
+            Size russian{ 0 };
+            Size ukrainian{ 0 };
+            Size ambiguous{ 0 };
+            // -- no branch on mark, letters of both languages are mixed unpredictably
+            void add( DetectMark mark ) noexcept {
+                russian += mark == DetectMark::Russian;
+                ukrainian += mark == DetectMark::Ukrainian;
+                ambiguous += mark == DetectMark::Ambiguous;
+            }
+            auto language( Language fallback ) const noexcept -> Language {
+                if ( russian > ukrainian ) return Language::Russian;
+                if ( ukrainian > russian ) return Language::Ukrainian;
+                return fallback;
+            }
+        };
+        auto detect_count( StringWordView in ) noexcept -> DetectCount {
+            DetectCount count;
+            for ( Unt2 word : in ) {
+                bool const block = ( word >> 8u ) == Encode_Block_Cyrillic_;
+                count.add( block ? Detect_Table_Words_[word & 0xFFu] : DetectMark::None );
+            }
+            return count;
+        }
+        // -- cyrillic block is two byte sequences led by D0 to D3, continuation byte never looks like lead
+        auto detect_count( StringByteView in ) noexcept -> DetectCount {
+            DetectCount count;
+            for ( Size i = 0; i + 1 < in.size( ); ++i ) {
+                auto const lead = static_cast< Unt0 >( in[i] );
+                auto const word = ( ( lead & 0x1Fu ) << 6u ) | ( static_cast< Unt0 >( in[i + 1] ) & 0x3Fu );
+                count.add( ( lead & 0xFCu ) == 0xD0u ? Detect_Table_Words_[word & 0xFFu] : DetectMark::None );
+            }
+            return count;
+        }
+        // -- walks encoded units, plain letters skipped without waiting on unit length
+        auto detect_count_encoded( StringByteView in ) noexcept -> DetectCount {
+            DetectCount count;
+            auto const size = in.size( );
+            for ( Size i = 0; i < size; ) {
+                auto const lower = static_cast< char >( in[i] | 0x20 );
+                if ( lower != 'j' && lower != 'x' ) {
+                    ++i;
+                    continue;
+                }
+                if ( lower == 'j' && i + 1 < size ) {
+                    auto const next = in[i + 1];
+                    if ( next == static_cast< char >( in[i] ^ ( 'j' ^ 'x' ) ) ) {
+                        if ( i + 2 < size ) count.add( Detect_Table_Encoded_JX_[static_cast< Unt0 >( in[i + 2] )] );
+                    } else count.add( Detect_Table_Encoded_J_[static_cast< Unt0 >( next )] );
+                }
+                i += encoded_unit( in, i );
+            }
+            return count;
+        }
+        // -- language of output, none without letters telling languages apart, language error when output depends on it
+        template< typename In >
+        [[nodiscard]]
+        auto encode_detect( StringByte &out, In in, Detect &detect ) -> Error {
+            auto const count = detect_count( in );
+            detect.detected = count.language( detect.fallback );
+            auto language = detect.detected;
+            if ( language == Language::None ) {
+                if ( count.russian || count.ukrainian ) return Error::Language;
+                language = Language::Russian; // same output for both
+            }
+            auto const thread = setting_thread( );
+            return encode_impl( out, in, Setting{ language, thread.validate, thread.cache } );
+        }
+        template< typename Data >
+        [[nodiscard]]
+        auto decode_detect( Data &out, Decoded::In in, Detect &detect ) -> Error {
+            auto const count = detect_count_encoded( in );
+            detect.detected = count.language( detect.fallback );
+            auto language = detect.detected;
+            if ( language == Language::None ) {
+                if ( count.ambiguous ) return Error::Language;
+                language = Language::Russian; // same output for both
+            }
+            auto const thread = setting_thread( );
+            return decode_impl( out, in, Setting{ language, thread.validate, thread.cache } );
+        }
+        // reencode tables
+        // -- letter after j, J, jx and JX prefix to glyph of same word in other language, empty glyph is invalid byte
+        // -- rows follow decoded states after Defaults, words are decoded with one language and encoded with another
+        using ArrayGlyphReencode = std::array< ArrayGlyphCyrillic, 4 >;
+        constexpr auto reencode_table( Language from, Language to ) -> ArrayGlyphReencode {
+            auto const asi = ( from == Language::Ukrainian ) ? 4 : 0;
+            auto const &encode = Encode_Table_Cyrillic_[static_cast< unsigned >( to ) - 1u];
+            ArrayGlyphReencode table{ };
+            for ( auto ali = 0; ali < 4; ++ali ) {
+                auto const letters = Decode_Letters_Mixed_[ali];
+                auto const sumvolu = Decode_Sumvolu_Mixed_[ali + asi];
+                for ( Size i = 0; i < letters.size( ); ++i ) {
+                    table[ali][static_cast< Unt0 >( letters[i] )] = encode[sumvolu[i] & 0xFFu];
+                }
+            }
+            return table;
+        }
+        using ArrayTableReencode = std::array< std::array< ArrayGlyphReencode, 2 >, 2 >;
+        constexpr ArrayTableReencode const Reencode_Table_{{
+            {{ reencode_table( Language::Russian, Language::Russian ), reencode_table( Language::Russian, Language::Ukrainian ) }},
+            {{ reencode_table( Language::Ukrainian, Language::Russian ), reencode_table( Language::Ukrainian, Language::Ukrainian ) }},
         }};
+        // -- plain letters decode and encode back to themselves, so only mixed letters need rewriting
+        constexpr auto check_reencode_plain( ) -> bool {
+            for ( Size i = 0; i < Decode_Letters_Plain_.size( ); ++i ) {
+                for ( auto const &table : Encode_Table_Cyrillic_ ) {
+                    auto const &glyph = table[Decode_Sumvolu_Plain_[i] & 0xFFu];
+                    if ( glyph.size != 1 || glyph.data[0] != Decode_Letters_Plain_[i] ) return false;
+                }
+            }
+            return true;
+        }
+        static_assert( check_reencode_plain( ) );
+        // reencode detail implementation
+        constexpr auto reencode_stop( char byte ) noexcept -> bool {
+            auto const lower = static_cast< char >( byte | 0x20 );
+            return lower == 'j' || lower == 'x';
+        }
+        // -- eight bytes per step while none of them may be j, J, x or X, false alarm just ends word steps
+        auto reencode_plain( StringByteView in, Size at ) noexcept -> Size {
+            constexpr Unt3 ones{ 0x0101010101010101ull };
+            constexpr Unt3 high{ 0x8080808080808080ull };
+            auto const zero = []( Unt3 word ) { return ( word - ones ) & ~word & high; };
+            auto i = at;
+            for ( ; i + 8 <= in.size( ); i += 8 ) {
+                Unt3 word;
+                std::memcpy( &word, in.data( ) + i, 8 );
+                word |= ones * 0x20u;
+                if ( zero( word ^ ( ones * 'j' ) ) | zero( word ^ ( ones * 'x' ) ) ) break;
+            }
+            while ( i < in.size( ) && not reencode_stop( in[i] ) ) ++i;
+            return i;
+        }
+        // -- runs between sequences copied whole, x prefix keeps appended letter from opening sequence
+        template< typename Sink >
+        [[nodiscard]]
+        auto reencode_kernel( Sink &tmp, StringByteView in, Language from, Language to ) -> Result {
+            if ( from == Language::None || to == Language::None ) return Result{ Error::Language, 0, 0 };
+            assert( from < Language::Size_ && to < Language::Size_ );
+            auto const &table = Reencode_Table_[from == Language::Ukrainian][to == Language::Ukrainian];
+            auto const used = tmp.size( );
+            auto const size = in.size( );
+            Size start = 0; // first byte of run not yet copied
+            for ( Size i = reencode_plain( in, 0 ); i < size; i = reencode_plain( in, i ) ) {
+                auto const byte = in[i];
+                if ( ( byte | 0x20 ) == 'x' ) {
+                    i += i + 1 < size ? 2 : 1;
+                    continue;
+                }
+                // -- table row follows decoded states: j, J, jx, JX
+                bool const upper = byte == 'J';
+                bool const prefix = i + 1 < size && in[i + 1] == ( upper ? 'X' : 'x' );
+                auto const at = i + 1 + prefix;
+                auto const &glyph = table[upper + 2 * prefix][static_cast< Unt0 >( at < size ? in[at] : 0 )];
+                if ( glyph.size == 0 ) {
+                    tmp.append( in.data( ) + start, i - start );
+                    return Result{ Error::InvalidByte, i, tmp.size( ) - used };
+                }
+                // -- sequence spelled same in both languages stays part of run
+                auto const length = at + 1 - i;
+                if ( glyph.size == length && std::memcmp( glyph.data.data( ), in.data( ) + i, length ) == 0 ) {
+                    i += length;
+                    continue;
+                }
+                tmp.append( in.data( ) + start, i - start );
+                tmp.append( glyph.data.data( ), glyph.size );
+                i = start = at + 1;
+            }
+            tmp.append( in.data( ) + start, size - start );
+            return Result{ Error::None, size, tmp.size( ) - used };
+        }
+        template< typename Sink >
+        [[nodiscard]]
+        auto reencode_core( Sink tmp, StringByteView in, Language from, Language to ) -> Result {
+            auto const capacity = tmp.capacity( );
+            auto const result = reencode_kernel( tmp, in, from, to );
+            stats_call( StatsKind::Reencode, Sink::Shape, in, result.written, result.code );
+            if ( tmp.capacity( ) != capacity ) stats_allocation( );
+            return result;
+        }
+        template< typename Data >
+        [[nodiscard]]
+        auto reencode_impl( Data &out, StringByteView in, Language from, Language to ) -> Error {
+            using Sink = SinkString< char, Data, StatsShape::String >;
+            Data tmp{ out.get_allocator( ) };
+            tmp.reserve( in.size( ) );
+            if ( tmp.capacity( ) ) stats_allocation( );
+            auto const result = reencode_core( Sink{ tmp }, in, from, to );
+            if ( not result ) return result.code;
+            if ( out.size( ) == out.capacity( ) ) tmp.shrink_to_fit( ), stats_shrink( );
+            out = std::move( tmp );
+            return Error::None;
+        }
+        // cache implementation
+        // -- key is kind, language and validate followed by raw input bytes, built in reused buffer
+        enum class CacheKind : char { Encode, Decode };
+        template< typename In >
+        auto cache_key( CacheKind kind, Language language, Validate validate, In in ) -> StringByteView {
+            thread_local StringByte key;
+            constexpr auto Head = 1 + sizeof( Language ) + sizeof( Validate );
+            auto const bytes = in.size( ) * sizeof( typename In::value_type );
+            key.resize( Head + bytes );
+            key[0] = static_cast< char >( kind );
+            std::memcpy( key.data( ) + 1, &language, sizeof( Language ) );
+            std::memcpy( key.data( ) + 1 + sizeof( Language ), &validate, sizeof( Validate ) );
+            if ( bytes ) std::memcpy( key.data( ) + Head, in.data( ), bytes );
+            return key;
+        }
+        // -- hash computed once per lookup, picks shard and is reused by shard index
+        struct CacheKey {
+            StringByteView view;
+            Size hash;
+            explicit CacheKey( StringByteView key ) noexcept : view{ key }, hash{ std::hash< StringByteView >{ }( key ) } { }
+            CacheKey( StringByteView key, Size keyHash ) noexcept : view{ key }, hash{ keyHash } { }
+            bool operator==( CacheKey const &other ) const noexcept { return view == other.view; }
+        };
+        struct CacheKeyHash {
+            auto operator()( CacheKey const &key ) const noexcept -> Size { return key.hash; }
+        };
     } // anonymous namespace
     // state implementation
     namespace this_thread {
         // state setters
         static void state( Error error ) noexcept { Error_ = error; }
         void state( Language language ) noexcept { Language_ = language; }
-        void state( Validate validate ) noexcept { Validate_ = validate; }
+        // -- whole mask rebuilds thread cache, flags and profiles avoid that cost
+        void state( Validate validate ) noexcept {
+            Validate_ = validate;
+            ValidateFlagCache_ = char_flag_cache_build( validate );
+        }
+        // -- prebuilt tables are copied, so profile may be destroyed right after selection
+        void state( ValidateProfile const &profile ) noexcept {
+            Validate_ = profile.validate( );
+            ValidateFlagCache_ = CharFlagCache{ profile.appends( ), profile.ignores( ) };
+        }
         void state( ValidateVeiled flags ) noexcept {
             auto append = static_cast< ValidateVeiledHalf >( flags >> Validate_Half_Bits );
             auto ignore = static_cast< ValidateVeiledHalf >( flags );
@@ -517,53 +1665,659 @@ namespace son8::cyrillic {
     // encode implementation
     // -- return
     auto encode( Encoded::Out out, Encoded::In in ) -> Error { return encode_impl( out, in ); }
+    auto encode( Encoded::Out out, StringByteView in ) -> Error { return encode_impl( out, in ); }
+    auto encode( StringBytePmr &out, Encoded::In in ) -> Error { return encode_impl( out, in ); }
+    auto encode( StringBytePmr &out, StringByteView in ) -> Error { return encode_impl( out, in ); }
     // -- output
     auto encode( Encoded::In in, Error &code ) -> Encoded {
         Encoded ret;
         code = encode_impl( ret.out( ), in );
         return ret;
     }
+    auto encode( StringByteView in, Error &code ) -> Encoded {
+        Encoded ret;
+        code = encode_impl( ret.out( ), in );
+        return ret;
+    }
+    auto encode( Encoded::In in, Error &code, MemoryResource *resource ) -> EncodedPmr {
+        EncodedPmr ret{ resource };
+        code = encode_impl( ret.out( ), in );
+        return ret;
+    }
+    auto encode( StringByteView in, Error &code, MemoryResource *resource ) -> EncodedPmr {
+        EncodedPmr ret{ resource };
+        code = encode_impl( ret.out( ), in );
+        return ret;
+    }
     // -- thread
     auto encode( Encoded::In in ) -> Encoded {
         Encoded ret;
         this_thread::state( encode_impl( ret.out( ), in ) );
         return ret;
     }
+    auto encode( StringByteView in ) -> Encoded {
+        Encoded ret;
+        this_thread::state( encode_impl( ret.out( ), in ) );
+        return ret;
+    }
+    auto encode( Encoded::In in, MemoryResource *resource ) -> EncodedPmr {
+        EncodedPmr ret{ resource };
+        this_thread::state( encode_impl( ret.out( ), in ) );
+        return ret;
+    }
+    auto encode( StringByteView in, MemoryResource *resource ) -> EncodedPmr {
+        EncodedPmr ret{ resource };
+        this_thread::state( encode_impl( ret.out( ), in ) );
+        return ret;
+    }
+    // -- span
+    auto encode( char *data, Size size, Encoded::In in ) -> Result { return encode_core( SinkSpan< char >{ data, size }, in, setting_thread( ) ); }
+    auto encode( char *data, Size size, StringByteView in ) -> Result { return encode_core( SinkSpan< char >{ data, size }, in, setting_thread( ) ); }
+    // -- append
+    auto encode_append( Encoded::Out out, Encoded::In in ) -> Result { return encode_core( SinkString< char >{ out }, in, setting_thread( ) ); }
+    auto encode_append( Encoded::Out out, StringByteView in ) -> Result { return encode_core( SinkString< char >{ out }, in, setting_thread( ) ); }
+    auto encode_append( StringBytePmr &out, Encoded::In in ) -> Result { return encode_core( SinkString{ out }, in, setting_thread( ) ); }
+    auto encode_append( StringBytePmr &out, StringByteView in ) -> Result { return encode_core( SinkString{ out }, in, setting_thread( ) ); }
+    // -- check
+    auto can_encode( Encoded::In in ) noexcept -> bool { return encode_reject( in, setting_thread( ), true ) == 0; }
+    auto can_encode( StringByteView in ) noexcept -> bool { return encode_reject( in, setting_thread( ), true ) == 0; }
+    auto count_invalid( Encoded::In in ) noexcept -> Size { return encode_reject( in, setting_thread( ), false ); }
+    auto count_invalid_utf8( StringByteView in ) noexcept -> Size { return encode_reject( in, setting_thread( ), false ); }
+    // -- resume
+    auto encode( char *data, Size size, Encoded::In in, Size from ) -> Result {
+        return resume_impl( in, from, [data,size]( Encoded::In rest ) { return encode( data, size, rest ); } );
+    }
+    auto encode( char *data, Size size, StringByteView in, Size from ) -> Result {
+        return resume_impl( in, from, [data,size]( StringByteView rest ) { return encode( data, size, rest ); } );
+    }
+    auto encode_append( Encoded::Out out, Encoded::In in, Size from ) -> Result {
+        return resume_impl( in, from, [&out]( Encoded::In rest ) { return encode_append( out, rest ); } );
+    }
+    auto encode_append( Encoded::Out out, StringByteView in, Size from ) -> Result {
+        return resume_impl( in, from, [&out]( StringByteView rest ) { return encode_append( out, rest ); } );
+    }
+    // -- parallel
+    auto encode( Encoded::Out out, Encoded::In in, Parallel parallel ) -> Error {
+        auto const setting = setting_thread( );
+        auto const bounds = parallel_bounds( in.size( ), parallel, []( Size ) { return true; } );
+        return parallel_impl( out, bounds, [&setting,in]( auto sink, Size from, Size to ) {
+            return encode_core( sink, in.substr( from, to - from ), setting );
+        } );
+    }
+    auto encode( Encoded::Out out, StringByteView in, Parallel parallel ) -> Error {
+        auto const setting = setting_thread( );
+        // -- split only before utf-8 lead byte
+        auto const bounds = parallel_bounds( in.size( ), parallel, [in]( Size bound ) { return ( in[bound] & 0xC0 ) != 0x80; } );
+        return parallel_impl( out, bounds, [&setting,in]( auto sink, Size from, Size to ) {
+            return encode_core( sink, in.substr( from, to - from ), setting );
+        } );
+    }
+    // -- batch
+    auto encode( EncodedColumn &out, StringWordView const *in, Size size ) -> Size {
+        auto const setting = setting_thread( );
+        return batch_impl( out, in, size, [&setting]( auto sink, StringWordView row ) { return encode_core( sink, row, setting ); } );
+    }
+    auto encode( EncodedColumn &out, StringByteView const *in, Size size ) -> Size {
+        auto const setting = setting_thread( );
+        return batch_impl( out, in, size, [&setting]( auto sink, StringByteView row ) { return encode_core( sink, row, setting ); } );
+    }
+    // -- size
+    auto encoded_size( Encoded::In in ) -> Result { return encode_core( SinkCount< char >{ }, in, setting_thread( ) ); }
+    auto encoded_size( StringByteView in ) -> Result { return encode_core( SinkCount< char >{ }, in, setting_thread( ) ); }
     // encoded implementation
-    Encoded::Encoded( In in ) { error_throw( encode_impl( out( ), in ) ); }
+    template< typename Data >
+    BasicEncoded< Data >::BasicEncoded( Allocator const &allocator ) noexcept : data_{ allocator } { }
+    template< typename Data >
+    BasicEncoded< Data >::BasicEncoded( In in ) { error_throw( encode_impl( out( ), in ) ); }
+    template< typename Data >
+    BasicEncoded< Data >::BasicEncoded( In in, Allocator const &allocator ) : data_{ allocator } { error_throw( encode_impl( out( ), in ) ); }
     // -- getters
-    auto Encoded::ref( ) const & noexcept -> Ref { return data_; }
-    auto Encoded::ptr( ) &       noexcept -> Ptr { return data_.data( ); }
-    auto Encoded::out( ) &       noexcept -> Out { return data_; }
-    auto Encoded::fwd( ) &       noexcept -> Fwd { return std::move( data_ ); }
-    auto Encoded::fwd( ) &&      noexcept ->Data { return std::move( data_ ); }
+    template< typename Data >
+    auto BasicEncoded< Data >::ref( ) const & noexcept -> Ref { return data_; }
+    template< typename Data >
+    auto BasicEncoded< Data >::ptr( ) &       noexcept -> Ptr { return data_.data( ); }
+    template< typename Data >
+    auto BasicEncoded< Data >::out( ) &       noexcept -> Out { return data_; }
+    template< typename Data >
+    auto BasicEncoded< Data >::fwd( ) &       noexcept -> Fwd { return std::move( data_ ); }
+    template< typename Data >
+    auto BasicEncoded< Data >::fwd( ) &&      noexcept ->Data { return std::move( data_ ); }
     // -- conversions
-    Encoded::operator View( ) const { return View{ data_ }; }
+    template< typename Data >
+    BasicEncoded< Data >::operator View( ) const { return View{ data_ }; }
+    // -- instantiations
+    template class BasicEncoded< StringByte >;
+    template class BasicEncoded< StringBytePmr >;
     // decode implementation
     // -- return
     auto decode( Decoded::Out out, Decoded::In in ) -> Error { return decode_impl( out, in ); }
+    auto decode( StringByte &out, Decoded::In in ) -> Error { return decode_impl( out, in ); }
+    auto decode( StringWordPmr &out, Decoded::In in ) -> Error { return decode_impl( out, in ); }
+    auto decode( StringBytePmr &out, Decoded::In in ) -> Error { return decode_impl( out, in ); }
     // -- output
     auto decode( Decoded::In in, Error &code ) -> Decoded {
         Decoded ret;
         code = decode_impl( ret.out( ), in );
         return ret;
     }
+    auto decode( Decoded::In in, Error &code, MemoryResource *resource ) -> DecodedPmr {
+        DecodedPmr ret{ resource };
+        code = decode_impl( ret.out( ), in );
+        return ret;
+    }
     // -- thread
     auto decode( Decoded::In in ) -> Decoded {
         Decoded ret;
         this_thread::state( decode_impl( ret.out( ), in ) );
         return ret;
     }
+    auto decode( Decoded::In in, MemoryResource *resource ) -> DecodedPmr {
+        DecodedPmr ret{ resource };
+        this_thread::state( decode_impl( ret.out( ), in ) );
+        return ret;
+    }
+    // -- span
+    auto decode( char16_t *data, Size size, Decoded::In in ) -> Result {
+        auto state = DecodedState::Defaults;
+        return decode_core< char16_t >( SinkSpan< char16_t >{ data, size }, in, setting_thread( ), state, true );
+    }
+    auto decode( char *data, Size size, Decoded::In in ) -> Result {
+        auto state = DecodedState::Defaults;
+        return decode_core< char >( SinkSpan< char >{ data, size }, in, setting_thread( ), state, true );
+    }
+    // -- append
+    auto decode_append( Decoded::Out out, Decoded::In in ) -> Result {
+        auto state = DecodedState::Defaults;
+        return decode_core< char16_t >( SinkString< char16_t >{ out }, in, setting_thread( ), state, true );
+    }
+    auto decode_append( StringByte &out, Decoded::In in ) -> Result {
+        auto state = DecodedState::Defaults;
+        return decode_core< char >( SinkString< char >{ out }, in, setting_thread( ), state, true );
+    }
+    auto decode_append( StringWordPmr &out, Decoded::In in ) -> Result {
+        auto state = DecodedState::Defaults;
+        return decode_core< char16_t >( SinkString{ out }, in, setting_thread( ), state, true );
+    }
+    auto decode_append( StringBytePmr &out, Decoded::In in ) -> Result {
+        auto state = DecodedState::Defaults;
+        return decode_core< char >( SinkString{ out }, in, setting_thread( ), state, true );
+    }
+    // -- check
+    auto can_decode( Decoded::In in ) noexcept -> bool { return decode_reject( in, setting_thread( ), true ) == 0; }
+    auto count_invalid( Decoded::In in ) noexcept -> Size { return decode_reject( in, setting_thread( ), false ); }
+    // -- resume
+    auto decode( char16_t *data, Size size, Decoded::In in, Size from ) -> Result {
+        return resume_impl( in, from, [data,size]( Decoded::In rest ) { return decode( data, size, rest ); } );
+    }
+    auto decode( char *data, Size size, Decoded::In in, Size from ) -> Result {
+        return resume_impl( in, from, [data,size]( Decoded::In rest ) { return decode( data, size, rest ); } );
+    }
+    auto decode_append( Decoded::Out out, Decoded::In in, Size from ) -> Result {
+        return resume_impl( in, from, [&out]( Decoded::In rest ) { return decode_append( out, rest ); } );
+    }
+    auto decode_append( StringByte &out, Decoded::In in, Size from ) -> Result {
+        return resume_impl( in, from, [&out]( Decoded::In rest ) { return decode_append( out, rest ); } );
+    }
+    // -- parallel
+    auto decode( Decoded::Out out, Decoded::In in, Parallel parallel ) -> Error { return decode_parallel( out, in, parallel ); }
+    auto decode( StringByte &out, Decoded::In in, Parallel parallel ) -> Error { return decode_parallel( out, in, parallel ); }
+    // -- batch
+    auto decode( DecodedColumn &out, StringByteView const *in, Size size ) -> Size {
+        auto const setting = setting_thread( );
+        return batch_impl( out, in, size, [&setting]( auto sink, StringByteView row ) {
+            auto state = DecodedState::Defaults;
+            return decode_core< char16_t >( sink, row, setting, state, true );
+        } );
+    }
+    // -- size
+    auto decoded_size( Decoded::In in ) -> Result {
+        auto state = DecodedState::Defaults;
+        return decode_core< char16_t >( SinkCount< char16_t >{ }, in, setting_thread( ), state, true );
+    }
     // decoded implementation
-    Decoded::Decoded( In in ) { error_throw( decode_impl( out( ), in ) ); }
+    template< typename Data >
+    BasicDecoded< Data >::BasicDecoded( Allocator const &allocator ) noexcept : data_{ allocator } { }
+    template< typename Data >
+    BasicDecoded< Data >::BasicDecoded( In in ) { error_throw( decode_impl( out( ), in ) ); }
+    template< typename Data >
+    BasicDecoded< Data >::BasicDecoded( In in, Allocator const &allocator ) : data_{ allocator } { error_throw( decode_impl( out( ), in ) ); }
     // -- getters
-    auto Decoded::ref( ) const & noexcept -> Ref { return data_; }
-    auto Decoded::ptr( ) &       noexcept -> Ptr { return data_.data( ); }
-    auto Decoded::out( ) &       noexcept -> Out { return data_; }
-    auto Decoded::fwd( ) &       noexcept -> Fwd { return std::move( data_ ); }
-    auto Decoded::fwd( ) &&      noexcept ->Data { return std::move( data_ ); }
+    template< typename Data >
+    auto BasicDecoded< Data >::ref( ) const & noexcept -> Ref { return data_; }
+    template< typename Data >
+    auto BasicDecoded< Data >::ptr( ) &       noexcept -> Ptr { return data_.data( ); }
+    template< typename Data >
+    auto BasicDecoded< Data >::out( ) &       noexcept -> Out { return data_; }
+    template< typename Data >
+    auto BasicDecoded< Data >::fwd( ) &       noexcept -> Fwd { return std::move( data_ ); }
+    template< typename Data >
+    auto BasicDecoded< Data >::fwd( ) &&      noexcept ->Data { return std::move( data_ ); }
     // -- conversions
-    Decoded::operator View( ) const { return View{ data_ }; }
+    template< typename Data >
+    BasicDecoded< Data >::operator View( ) const { return View{ data_ }; }
+    // -- instantiations
+    template class BasicDecoded< StringWord >;
+    template class BasicDecoded< StringWordPmr >;
+    // encoder implementation
+    Encoder::Encoder( ) noexcept : Encoder{ this_thread::state_language( ), this_thread::state_validate( ) } { }
+    Encoder::Encoder( Language language, Validate validate ) noexcept : language_{ language }, profile_{ validate } { }
+    auto Encoder::feed( StringByte &sink, StringWordView chunk ) -> Error {
+        if ( not pending_.empty( ) ) return Error::ConvertFailed;
+        return encode_core( SinkStream< char >{ sink }, chunk, Setting{ language_, profile_.validate( ), profile_ } ).code;
+    }
+    auto Encoder::feed( StringByte &sink, StringByteView chunk ) -> Error {
+        Setting const setting{ language_, profile_.validate( ), profile_ };
+        if ( not pending_.empty( ) ) {
+            // -- complete sequence left from previous chunk with leading bytes of this one
+            auto const need = utf8_length( static_cast< Unt0 >( pending_.front( ) ) ) - pending_.size( );
+            auto const take = need < chunk.size( ) ? need : chunk.size( );
+            pending_.append( chunk.data( ), take );
+            chunk.remove_prefix( take );
+            if ( take < need ) return Error::None;
+            auto const result = encode_core( SinkStream< char >{ sink }, StringByteView{ pending_ }, setting );
+            pending_.clear( );
+            if ( not result ) return result.code;
+        }
+        auto const tail = utf8_tail( chunk );
+        pending_.assign( chunk.data( ) + chunk.size( ) - tail, tail );
+        chunk.remove_suffix( tail );
+        return encode_core( SinkStream< char >{ sink }, chunk, setting ).code;
+    }
+    auto Encoder::finish( ) -> Error {
+        bool const incomplete = not pending_.empty( );
+        pending_.clear( );
+        return incomplete ? Error::ConvertFailed : Error::None;
+    }
+    // decoder implementation
+    Decoder::Decoder( ) noexcept : Decoder{ this_thread::state_language( ) } { }
+    Decoder::Decoder( Language language ) noexcept
+        : language_{ language }
+        , state_{ static_cast< Unt0 >( DecodedState::Defaults ) } { }
+    auto Decoder::feed( StringWord &sink, StringByteView chunk ) -> Error { return decode_feed( sink, chunk, language_, state_ ); }
+    auto Decoder::feed( StringByte &sink, StringByteView chunk ) -> Error { return decode_feed( sink, chunk, language_, state_ ); }
+    auto Decoder::finish( ) -> Error {
+        bool const incomplete = state_ != static_cast< Unt0 >( DecodedState::Defaults );
+        state_ = static_cast< Unt0 >( DecodedState::Defaults );
+        return incomplete ? Error::InvalidByte : Error::None;
+    }
+    // codec implementation
+    // -- flag tables built once into own profile, thread state is never read after construction
+    Codec::Codec( ) noexcept : Codec{ this_thread::state_language( ), this_thread::state_validate( ) } { }
+    Codec::Codec( Language language, Validate validate ) noexcept : language_{ language }, profile_{ validate } { }
+    Codec::Codec( Language language, ValidateProfile const &profile ) noexcept : language_{ language }, profile_{ profile } { }
+    auto Codec::language( ) const noexcept -> Language { return language_; }
+    auto Codec::validate( ) const noexcept -> Validate { return profile_.validate( ); }
+    auto Codec::profile( ) const noexcept -> ValidateProfile const & { return profile_; }
+    // -- encode
+    auto Codec::encode( StringByte &out, StringWordView in ) const -> Error {
+        return encode_impl( out, in, Setting{ language_, profile_.validate( ), profile_ } );
+    }
+    auto Codec::encode( StringByte &out, StringByteView in ) const -> Error {
+        return encode_impl( out, in, Setting{ language_, profile_.validate( ), profile_ } );
+    }
+    auto Codec::encode( char *data, Size size, StringWordView in ) const -> Result {
+        return encode_core( SinkSpan< char >{ data, size }, in, Setting{ language_, profile_.validate( ), profile_ } );
+    }
+    auto Codec::encode( char *data, Size size, StringByteView in ) const -> Result {
+        return encode_core( SinkSpan< char >{ data, size }, in, Setting{ language_, profile_.validate( ), profile_ } );
+    }
+    auto Codec::encode_append( StringByte &out, StringWordView in ) const -> Result {
+        return encode_core( SinkString< char >{ out }, in, Setting{ language_, profile_.validate( ), profile_ } );
+    }
+    auto Codec::encode_append( StringByte &out, StringByteView in ) const -> Result {
+        return encode_core( SinkString< char >{ out }, in, Setting{ language_, profile_.validate( ), profile_ } );
+    }
+    auto Codec::encoded_size( StringWordView in ) const -> Result {
+        return encode_core( SinkCount< char >{ }, in, Setting{ language_, profile_.validate( ), profile_ } );
+    }
+    auto Codec::encoded_size( StringByteView in ) const -> Result {
+        return encode_core( SinkCount< char >{ }, in, Setting{ language_, profile_.validate( ), profile_ } );
+    }
+    auto Codec::can_encode( StringWordView in ) const noexcept -> bool {
+        return encode_reject( in, Setting{ language_, profile_.validate( ), profile_ }, true ) == 0;
+    }
+    auto Codec::can_encode( StringByteView in ) const noexcept -> bool {
+        return encode_reject( in, Setting{ language_, profile_.validate( ), profile_ }, true ) == 0;
+    }
+    // -- decode, only language matters
+    auto Codec::decode( StringWord &out, StringByteView in ) const -> Error {
+        return decode_impl( out, in, Setting{ language_, profile_.validate( ), profile_ } );
+    }
+    auto Codec::decode( StringByte &out, StringByteView in ) const -> Error {
+        return decode_impl( out, in, Setting{ language_, profile_.validate( ), profile_ } );
+    }
+    auto Codec::decode( char16_t *data, Size size, StringByteView in ) const -> Result {
+        auto state = DecodedState::Defaults;
+        return decode_core< char16_t >( SinkSpan< char16_t >{ data, size }, in, Setting{ language_, profile_.validate( ), profile_ }, state, true );
+    }
+    auto Codec::decode( char *data, Size size, StringByteView in ) const -> Result {
+        auto state = DecodedState::Defaults;
+        return decode_core< char >( SinkSpan< char >{ data, size }, in, Setting{ language_, profile_.validate( ), profile_ }, state, true );
+    }
+    auto Codec::decode_append( StringWord &out, StringByteView in ) const -> Result {
+        auto state = DecodedState::Defaults;
+        return decode_core< char16_t >( SinkString< char16_t >{ out }, in, Setting{ language_, profile_.validate( ), profile_ }, state, true );
+    }
+    auto Codec::decode_append( StringByte &out, StringByteView in ) const -> Result {
+        auto state = DecodedState::Defaults;
+        return decode_core< char >( SinkString< char >{ out }, in, Setting{ language_, profile_.validate( ), profile_ }, state, true );
+    }
+    auto Codec::can_decode( StringByteView in ) const noexcept -> bool {
+        return decode_reject( in, Setting{ language_, profile_.validate( ), profile_ }, true ) == 0;
+    }
+    auto Codec::decoded_size( StringByteView in ) const -> Result {
+        auto state = DecodedState::Defaults;
+        return decode_core< char16_t >( SinkCount< char16_t >{ }, in, Setting{ language_, profile_.validate( ), profile_ }, state, true );
+    }
+    // cache implementation
+    // -- entries never move, index keys view strings owned by entries
+    struct Cache::Shard {
+        struct Entry {
+            StringByte key;
+            EncodedPtr encoded; // one of results is set, kind is part of key
+            DecodedPtr decoded;
+            bool referenced{ false };
+        };
+        std::mutex mutex;
+        std::vector< Entry > entries;
+        std::unordered_map< CacheKey, Size, CacheKeyHash > index;
+        Size capacity{ 0 };
+        Size hand{ 0 }; // clock hand, next eviction candidate
+        std::atomic< Size > hits{ 0 };
+        std::atomic< Size > misses{ 0 };
+        // -- make runs outside of lock, concurrent misses on same key may both compute
+        template< typename Ptr, typename Make >
+        auto find( CacheKey const &key, Ptr Entry::*result, Make make ) -> Ptr {
+            {
+                std::lock_guard< std::mutex > lock{ mutex };
+                if ( auto const it = index.find( key ); it != index.end( ) ) {
+                    hits.fetch_add( 1, std::memory_order_relaxed );
+                    auto &entry = entries[it->second];
+                    entry.referenced = true;
+                    return entry.*result;
+                }
+            }
+            misses.fetch_add( 1, std::memory_order_relaxed );
+            Ptr value = make( );
+            if ( not value ) return value;
+            std::lock_guard< std::mutex > lock{ mutex };
+            if ( index.find( key ) != index.end( ) ) return value;
+            Size slot;
+            if ( entries.size( ) < capacity ) {
+                slot = entries.size( );
+                entries.emplace_back( );
+            } else {
+                while ( entries[hand].referenced ) {
+                    entries[hand].referenced = false;
+                    hand = ( hand + 1 ) % capacity;
+                }
+                slot = hand;
+                hand = ( hand + 1 ) % capacity;
+                index.erase( CacheKey{ entries[slot].key } );
+            }
+            auto &entry = entries[slot];
+            entry.key.assign( key.view );
+            entry.encoded = nullptr;
+            entry.decoded = nullptr;
+            entry.*result = value;
+            entry.referenced = false;
+            index.emplace( CacheKey{ entry.key, key.hash }, slot );
+            return value;
+        }
+        void clear( ) {
+            std::lock_guard< std::mutex > lock{ mutex };
+            index.clear( );
+            entries.clear( );
+            hand = 0;
+        }
+    };
+    Cache::Cache( Size capacity, unsigned shards ) : shards_{ }, count_{ shards ? shards : 1u } {
+        shards_.reset( new Shard[count_] );
+        Size const each = capacity > count_ ? ( capacity + count_ - 1 ) / count_ : 1;
+        for ( unsigned i = 0; i < count_; ++i ) {
+            shards_[i].capacity = each;
+            shards_[i].entries.reserve( each );
+            shards_[i].index.reserve( each );
+        }
+    }
+    Cache::~Cache( ) = default;
+    // -- shard picked by key hash
+    auto Cache::encode( Encoded::In in, Error &code ) -> EncodedPtr {
+        code = Error::None;
+        CacheKey const key{ cache_key( CacheKind::Encode, Language_, Validate_, in ) };
+        auto &shard = shards_[key.hash % count_];
+        return shard.find( key, &Shard::Entry::encoded, [&]( ) -> EncodedPtr {
+            Encoded ret;
+            code = encode_impl( ret.out( ), in );
+            if ( code != Error::None ) return nullptr;
+            return std::make_shared< Encoded const >( std::move( ret ) );
+        } );
+    }
+    auto Cache::encode( Codec const &codec, Encoded::In in, Error &code ) -> EncodedPtr {
+        code = Error::None;
+        CacheKey const key{ cache_key( CacheKind::Encode, codec.language( ), codec.validate( ), in ) };
+        auto &shard = shards_[key.hash % count_];
+        return shard.find( key, &Shard::Entry::encoded, [&]( ) -> EncodedPtr {
+            Encoded ret;
+            code = codec.encode( ret.out( ), in );
+            if ( code != Error::None ) return nullptr;
+            return std::make_shared< Encoded const >( std::move( ret ) );
+        } );
+    }
+    // -- validate does not change decode, it is left out of key
+    auto Cache::decode( Decoded::In in, Error &code ) -> DecodedPtr {
+        code = Error::None;
+        CacheKey const key{ cache_key( CacheKind::Decode, Language_, Validate::None, in ) };
+        auto &shard = shards_[key.hash % count_];
+        return shard.find( key, &Shard::Entry::decoded, [&]( ) -> DecodedPtr {
+            Decoded ret;
+            code = decode_impl( ret.out( ), in );
+            if ( code != Error::None ) return nullptr;
+            return std::make_shared< Decoded const >( std::move( ret ) );
+        } );
+    }
+    auto Cache::decode( Codec const &codec, Decoded::In in, Error &code ) -> DecodedPtr {
+        code = Error::None;
+        CacheKey const key{ cache_key( CacheKind::Decode, codec.language( ), Validate::None, in ) };
+        auto &shard = shards_[key.hash % count_];
+        return shard.find( key, &Shard::Entry::decoded, [&]( ) -> DecodedPtr {
+            Decoded ret;
+            code = codec.decode( ret.out( ), in );
+            if ( code != Error::None ) return nullptr;
+            return std::make_shared< Decoded const >( std::move( ret ) );
+        } );
+    }
+    auto Cache::hits( ) const noexcept -> Size {
+        Size sum = 0;
+        for ( unsigned i = 0; i < count_; ++i ) sum += shards_[i].hits.load( std::memory_order_relaxed );
+        return sum;
+    }
+    auto Cache::misses( ) const noexcept -> Size {
+        Size sum = 0;
+        for ( unsigned i = 0; i < count_; ++i ) sum += shards_[i].misses.load( std::memory_order_relaxed );
+        return sum;
+    }
+    auto Cache::size( ) const noexcept -> Size {
+        Size sum = 0;
+        for ( unsigned i = 0; i < count_; ++i ) {
+            std::lock_guard< std::mutex > lock{ shards_[i].mutex };
+            sum += shards_[i].entries.size( );
+        }
+        return sum;
+    }
+    void Cache::clear( ) { for ( unsigned i = 0; i < count_; ++i ) shards_[i].clear( ); }
+    // profile implementation
+    ValidateProfile::ValidateProfile( ) noexcept : validate_{ Validate::None } { }
+    ValidateProfile::ValidateProfile( Validate validate ) noexcept : validate_{ validate } {
+        auto const cache = char_flag_cache_build( validate );
+        appends_ = cache.appends( );
+        ignores_ = cache.ignores( );
+    }
+    // -- flags folded into mask first, so profile equals one built from same mask
+    ValidateProfile::ValidateProfile( std::initializer_list< ValidateFlags > appends, std::initializer_list< ValidateFlags > ignores ) noexcept
+        : ValidateProfile{ [&]( ) {
+            ValidateVeiled mask{ 0 };
+            for ( auto const flag : ignores ) mask |= ValidateVeiled{ 1 } << static_cast< ValidateFlagsVeiled >( flag );
+            for ( auto const flag : appends ) {
+                auto const bit = static_cast< ValidateFlagsVeiled >( flag );
+                mask &= ~( ValidateVeiled{ 1 } << bit );
+                mask |= ValidateVeiled{ 1 } << ( bit + Validate_Half_Bits );
+            }
+            return static_cast< Validate >( mask );
+        }( ) } { }
+    auto ValidateProfile::validate( ) const noexcept -> Validate { return validate_; }
+    auto ValidateProfile::appends( ) const noexcept -> std::bitset< 128 > const & { return appends_; }
+    auto ValidateProfile::ignores( ) const noexcept -> std::bitset< 128 > const & { return ignores_; }
+    // stats implementation
+    auto Stats::operator+=( Stats const &other ) noexcept -> Stats & {
+        for ( Size k = 0; k < calls.size( ); ++k ) {
+            for ( Size s = 0; s < calls[k].size( ); ++s ) calls[k][s] += other.calls[k][s];
+            input[k] += other.input[k];
+            output[k] += other.output[k];
+        }
+        for ( Size e = 0; e < errors.size( ); ++e ) errors[e] += other.errors[e];
+        allocations += other.allocations;
+        shrinks += other.shrinks;
+        return *this;
+    }
+    // -- live counters may move on while summed, each one is read atomically
+    auto stats( ) -> Stats {
+        auto &registry = stats_registry( );
+        std::lock_guard< std::mutex > lock{ registry.mutex };
+        auto ret = registry.retired;
+        for ( auto const *thread : registry.live ) ret += thread->block.load( );
+        return ret;
+    }
+    namespace this_thread {
+        auto stats( ) -> Stats {
+            if constexpr ( Stats_Enabled_ ) return Stats_.block.load( ); // unregistered thread reads zeros
+            else return Stats{ };
+        }
+    } // namespace
+    // detect implementation
+    auto detect( StringWordView in, Language fallback ) noexcept -> Language { return detect_count( in ).language( fallback ); }
+    auto detect( StringByteView in, Language fallback ) noexcept -> Language { return detect_count( in ).language( fallback ); }
+    auto detect_encoded( StringByteView in, Language fallback ) noexcept -> Language { return detect_count_encoded( in ).language( fallback ); }
+    auto encode( StringByte &out, StringWordView in, Detect &detect ) -> Error { return encode_detect( out, in, detect ); }
+    auto encode( StringByte &out, StringByteView in, Detect &detect ) -> Error { return encode_detect( out, in, detect ); }
+    auto decode( StringWord &out, StringByteView in, Detect &detect ) -> Error { return decode_detect( out, in, detect ); }
+    auto decode( StringByte &out, StringByteView in, Detect &detect ) -> Error { return decode_detect( out, in, detect ); }
+    // reencode implementation
+    auto reencode( StringByte &out, StringByteView in, Language from, Language to ) -> Error { return reencode_impl( out, in, from, to ); }
+    auto reencode( StringBytePmr &out, StringByteView in, Language from, Language to ) -> Error { return reencode_impl( out, in, from, to ); }
+    auto reencode_append( StringByte &out, StringByteView in, Language from, Language to ) -> Result {
+        return reencode_core( SinkString< char >{ out }, in, from, to );
+    }
+    // search implementation
+    Search::Search( std::initializer_list< StringWordView > queries ) : Search{ Codec{ }, queries } { }
+    Search::Search( std::vector< StringWordView > const &queries ) : Search{ Codec{ }, queries } { }
+    Search::Search( Codec const &codec, std::initializer_list< StringWordView > queries )
+        : Search{ codec, std::vector< StringWordView >{ queries } } { }
+    Search::Search( Codec const &codec, std::vector< StringWordView > const &queries ) {
+        patterns_.resize( queries.size( ) );
+        decoded_.resize( queries.size( ) );
+        for ( Size i = 0; i < queries.size( ); ++i ) {
+            error_throw( codec.encode( patterns_[i], queries[i] ) );
+            decoded_[i] = decoded_offset( patterns_[i], patterns_[i].size( ) );
+            if ( not patterns_[i].empty( ) ) order_.push_back( i );
+        }
+        // -- bucket per first byte, longer patterns checked first
+        auto const first = [this]( Size i ) { return static_cast< Unt0 >( patterns_[i].front( ) ); };
+        std::sort( order_.begin( ), order_.end( ), [&]( Size lhs, Size rhs ) {
+            if ( first( lhs ) != first( rhs ) ) return first( lhs ) < first( rhs );
+            return patterns_[lhs].size( ) > patterns_[rhs].size( );
+        } );
+        for ( auto const i : order_ ) ++buckets_[first( i ) + 1];
+        for ( Size b = 1; b < buckets_.size( ); ++b ) buckets_[b] += buckets_[b - 1];
+        for ( auto const i : order_ ) stops_[first( i )] = true;
+        for ( auto const byte : { 'j', 'J', 'x', 'X' } ) stops_[static_cast< Unt0 >( byte )] = true;
+    }
+    auto Search::pattern( Size index ) const noexcept -> StringByteView { return patterns_[index]; }
+    auto Search::size( ) const noexcept -> Size { return patterns_.size( ); }
+    // -- text walked by whole units, so every candidate offset is sequence boundary
+    auto Search::find_at( StringByteView text, Size offset, Size decoded ) const noexcept -> SearchMatch {
+        auto const *data = text.data( );
+        auto const size = text.size( );
+        for ( auto at = offset; at < size; ++decoded ) {
+            // -- other bytes are single units starting no query, run skipped without waiting on previous step
+            while ( not stops_[static_cast< Unt0 >( data[at] )] ) {
+                ++at, ++decoded;
+                if ( at == size ) return SearchMatch{ };
+            }
+            auto const byte = static_cast< Unt0 >( data[at] );
+            for ( auto b = buckets_[byte]; b < buckets_[byte + 1]; ++b ) {
+                auto const &pattern = patterns_[order_[b]];
+                if ( pattern.size( ) > size - at ) continue;
+                // -- second byte checked inline, j prefixed letters share first byte
+                if ( pattern.size( ) > 1 && data[at + 1] != pattern[1] ) continue;
+                if ( std::memcmp( data + at, pattern.data( ), pattern.size( ) ) == 0 ) {
+                    return SearchMatch{ order_[b], at, pattern.size( ), decoded, decoded_[order_[b]] };
+                }
+            }
+            // -- same steps as encoded_unit without branches, prefixes are mixed with letters unpredictably
+            auto const lower = static_cast< char >( byte | 0x20u );
+            auto const next = at + 1 < size ? data[at + 1] : '\0';
+            Size const prefix = lower == 'j' || lower == 'x';
+            Size const third = lower == 'j' && next == static_cast< char >( byte ^ ( 'j' ^ 'x' ) );
+            at += 1 + prefix + third;
+        }
+        return SearchMatch{ };
+    }
+    auto Search::find( StringByteView text ) const noexcept -> SearchMatch { return find_at( text, 0, 0 ); }
+    auto Search::find( StringByteView text, SearchMatch const &previous ) const noexcept -> SearchMatch {
+        if ( not previous ) return SearchMatch{ };
+        return find_at( text, previous.offset + previous.size, previous.decoded_offset + previous.decoded_size );
+    }
+    auto Search::contains( StringByteView text ) const noexcept -> bool { return static_cast< bool >( find( text ) ); }
+    auto decoded_offset( StringByteView encoded, Size offset ) noexcept -> Size {
+        Size units = 0;
+        for ( Size at = 0; at < offset && at < encoded.size( ); at += encoded_unit( encoded, at ) ) ++units;
+        return units;
+    }
+    auto encoded_offset( StringByteView encoded, Size decoded ) noexcept -> Size {
+        Size at = 0;
+        for ( ; decoded && at < encoded.size( ); --decoded ) at += encoded_unit( encoded, at );
+        return at;
+    }
+    // view implementation
+    // -- chunk ends where buffer is full, overflow is not failure of view and never reaches stats
+    template< typename In >
+    auto BasicEncodeView< In >::fill( void const *view, Size read, char *data, Size size ) -> Result {
+        auto const &self = *static_cast< BasicEncodeView const * >( view );
+        auto const in = self.in_.substr( read );
+        if ( in.empty( ) ) return Result{ };
+        auto const setting = self.codec_ ? setting_codec( *self.codec_ ) : setting_thread( );
+        auto result = encode_kernel( SinkSpan< char, StatsShape::View >{ data, size }, in, setting );
+        if ( result.code == Error::OutputOverflow ) result.code = Error::None;
+        stats_call( StatsKind::Encode, StatsShape::View, in.substr( 0, result.read ), result.written, result.code );
+        return result;
+    }
+    template< typename In >
+    auto BasicEncodeView< In >::check( ) const -> Result {
+        return encode_core( SinkCount< char >{ }, in_, codec_ ? setting_codec( *codec_ ) : setting_thread( ) );
+    }
+    template< typename Char >
+    auto BasicDecodeView< Char >::fill( void const *view, Size read, Char *data, Size size ) -> Result {
+        auto const &self = *static_cast< BasicDecodeView const * >( view );
+        auto const in = self.in_.substr( read );
+        if ( in.empty( ) ) return Result{ };
+        auto const setting = self.codec_ ? setting_codec( *self.codec_ ) : setting_thread( );
+        auto state = DecodedState::Defaults;
+        auto result = decode_kernel< Char >( SinkSpan< Char, StatsShape::View >{ data, size }, in, setting, state, true );
+        if ( result.code == Error::OutputOverflow ) result.code = Error::None;
+        stats_call( StatsKind::Decode, StatsShape::View, in.substr( 0, result.read ), result.written * sizeof( Char ), result.code );
+        return result;
+    }
+    template< typename Char >
+    auto BasicDecodeView< Char >::check( ) const -> Result {
+        auto state = DecodedState::Defaults;
+        return decode_core< Char >( SinkCount< Char >{ }, in_, codec_ ? setting_codec( *codec_ ) : setting_thread( ), state, true );
+    }
+    // -- instantiations
+    template class BasicEncodeView< StringWordView >;
+    template class BasicEncodeView< StringByteView >;
+    template class BasicDecodeView< char16_t >;
+    template class BasicDecodeView< char >;
     // error implementation
     auto error_message( Error code ) noexcept -> char const * {
         auto ec = static_cast< unsigned >( code );
@@ -573,14 +2327,16 @@ namespace son8::cyrillic {
     // convert implementation
     [[nodiscard]] auto string_byte( StringWordView in ) -> StringByte {
         StringByte out;
-        this_thread::state( convert_impl( out, in ) );
+        this_thread::state( convert_impl( out, in ).code );
         return out;
     }
     [[nodiscard]] auto string_word( StringByteView in ) -> StringWord {
         StringWord out;
-        this_thread::state( convert_impl( out, in ) );
+        this_thread::state( convert_impl( out, in ).code );
         return out;
     }
+    auto string_byte( StringByte &out, StringWordView in ) -> Result { return convert_impl( out, in ); }
+    auto string_word( StringWord &out, StringByteView in ) -> Result { return convert_impl( out, in ); }
     // exception implementation
     Exception::Exception( Error code ) noexcept : code_{ code } { assert( code != Error::None ); }
     auto Exception::code( ) const noexcept -> Error { return code_; }
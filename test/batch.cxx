@@ -0,0 +1,47 @@
+#include "check.hxx"
+// std headers
+#include <vector>
+
+using namespace son8::cyrillic;
+using namespace son8::cyrillic::test;
+
+int main( ) {
+    this_thread::state( Language::Ukrainian );
+    this_thread::state( Validate::None );
+    Random random{ 5 };
+    // rows match one by one calls, failed rows are counted and left empty
+    std::vector< StringWord > words;
+    for ( int row = 0; row < 300; ++row ) words.push_back( random.words( row % 7 ? Pool_Letters_ : Pool_Ascii_, random.below( 24 ) ) );
+    std::vector< StringWordView > views( words.begin( ), words.end( ) );
+    std::vector< StringByte > utf8;
+    for ( auto const &row : words ) utf8.push_back( string_byte( row ) );
+    std::vector< StringByteView > utf8views( utf8.begin( ), utf8.end( ) );
+    EncodedColumn column;
+    auto const failed = encode( column, views.data( ), views.size( ) );
+    SON8_CHECK( column.size( ) == words.size( ) );
+    Size expect = 0;
+    std::vector< StringByte > bytes;
+    for ( Size i = 0; i < words.size( ); ++i ) {
+        StringByte out;
+        auto const code = encode( out, words[i] );
+        expect += code != Error::None;
+        SON8_CHECK( column.errors[i] == code );
+        SON8_CHECK( column.row( i ) == ( code == Error::None ? out : StringByte{ } ) );
+        bytes.push_back( out );
+    }
+    SON8_CHECK( failed == expect && expect != 0 );
+    EncodedColumn fromUtf8;
+    SON8_CHECK( encode( fromUtf8, utf8views.data( ), utf8views.size( ) ) == failed );
+    SON8_CHECK( fromUtf8.data == column.data && fromUtf8.offsets == column.offsets );
+    // decode back rows encoded above, column appends after earlier rows
+    std::vector< StringByteView > encoded( bytes.begin( ), bytes.end( ) );
+    DecodedColumn decoded;
+    SON8_CHECK( decode( decoded, encoded.data( ), encoded.size( ) ) == 0 );
+    SON8_CHECK( decode( decoded, encoded.data( ), 1 ) == 0 && decoded.size( ) == words.size( ) + 1 );
+    for ( Size i = 0; i < words.size( ); ++i ) {
+        SON8_CHECK( decoded.row( i ) == ( column.errors[i] == Error::None ? words[i] : StringWord{ } ) );
+    }
+    decoded.clear( );
+    SON8_CHECK( decoded.size( ) == 0 && decoded.offsets.size( ) == 1 );
+    return finish( );
+}
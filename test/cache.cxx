@@ -0,0 +1,57 @@
+#include "check.hxx"
+// std headers
+#include <thread>
+#include <vector>
+
+using namespace son8::cyrillic;
+using namespace son8::cyrillic::test;
+
+int main( ) {
+    this_thread::state( Language::Russian );
+    this_thread::state( Validate::None );
+    Random random{ 10 };
+    Cache cache{ 64, 4 };
+    // results equal direct calls, repeated token is hit
+    auto const words = random.words( Pool_Letters_, 20 );
+    Error code{ Error::Language };
+    auto const first = cache.encode( words, code );
+    SON8_CHECK( first && code == Error::None && first->ref( ) == encode( words ).ref( ) );
+    auto const second = cache.encode( words, code );
+    SON8_CHECK( second == first && cache.hits( ) == 1 && cache.misses( ) == 1 );
+    auto const back = cache.decode( first->ref( ), code );
+    SON8_CHECK( back && back->ref( ) == words );
+    // language and validate are part of key
+    Codec const ukrainian{ Language::Ukrainian, Validate::None };
+    auto const other = cache.encode( ukrainian, u"Ї", code );
+    SON8_CHECK( other && other->ref( ) == "JI" && cache.encode( u"Ї", code )->ref( ) == "JXY" );
+    // failed result is null and never cached
+    SON8_CHECK( cache.encode( u"!", code ) == nullptr && code == Error::InvalidWord );
+    auto const size = cache.size( );
+    SON8_CHECK( cache.encode( u"!", code ) == nullptr && cache.size( ) == size );
+    // bounded by capacity, evicted result stays valid for holder
+    for ( int round = 0; round < 1000; ++round ) ( void )cache.encode( random.words( Pool_Letters_, 8 ), code );
+    SON8_CHECK( cache.size( ) <= 64 && first->ref( ) == encode( words ).ref( ) );
+    cache.clear( );
+    SON8_CHECK( cache.size( ) == 0 );
+    // shared between threads with own settings
+    std::vector< StringWord > tokens;
+    for ( int i = 0; i < 32; ++i ) tokens.push_back( random.words( Pool_Letters_, 1 + random.below( 12 ) ) );
+    std::vector< std::thread > threads;
+    std::vector< int > failures( 4, 0 );
+    for ( unsigned t = 0; t < failures.size( ); ++t ) {
+        threads.emplace_back( [&, t] {
+            this_thread::state( Languages_[t % 2] );
+            this_thread::state( Validate::None );
+            for ( int round = 0; round < 2000; ++round ) {
+                auto const &token = tokens[( round * 7 + t ) % tokens.size( )];
+                Error error{ Error::Language };
+                auto const result = cache.encode( token, error );
+                failures[t] += not result || result->ref( ) != encode( token ).ref( );
+            }
+        } );
+    }
+    for ( auto &thread : threads ) thread.join( );
+    for ( auto failed : failures ) SON8_CHECK( failed == 0 );
+    SON8_CHECK( cache.hits( ) + cache.misses( ) > 8000 );
+    return finish( );
+}
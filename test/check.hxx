@@ -0,0 +1,50 @@
+#ifndef SON8_CYRILLIC_TEST_CHECK_HXX
+#define SON8_CYRILLIC_TEST_CHECK_HXX
+
+#include <son8/cyrillic.hxx>
+// std headers
+#include <cstdio>
+#include <random>
+#include <string_view>
+
+namespace son8::cyrillic::test {
+
+    // failures are reported and counted, test goes on to report every broken check
+    inline int Failures_{ 0 };
+    inline void check( bool passed, char const *expression, char const *file, int line ) {
+        if ( passed ) return;
+        ++Failures_;
+        std::fprintf( stderr, "%s:%d: check failed: %s\n", file, line, expression );
+    }
+    inline auto finish( ) -> int {
+        if ( Failures_ ) std::fprintf( stderr, "%d check(s) failed\n", Failures_ );
+        return Failures_ ? 1 : 0;
+    }
+
+    // letters of both languages in both cases, every one encodes and decodes back
+    inline constexpr StringWordView Pool_Russian_{ u"АБВГДЕЁЖЗИЙКЛМНОПРСТУФХЦЧШЩЪЫЬЭЮЯабвгдеёжзийклмнопрстуфхцчшщъыьэюя" };
+    inline constexpr StringWordView Pool_Ukrainian_{ u"АБВГҐДЕЄЖЗИІЇЙКЛМНОПРСТУФХЦЧШЩЬЮЯабвгґдеєжзиіїйклмнопрстуфхцчшщьюя" };
+    inline constexpr StringWordView Pool_Letters_{ u"АБВГҐДЕЁЄЖЗИІЇЙКЛМНОПРСТУФХЦЧШЩЪЫЬЭЮЯабвгґдеёєжзиіїйклмнопрстуфхцчшщъыьэюя" };
+    inline constexpr StringWordView Pool_Ascii_{ u"abcdefghijklmnopqrstuvwxyz ABCXYZ 0123456789 .,:;!?()" };
+    inline constexpr Language Languages_[2]{ Language::Russian, Language::Ukrainian };
+
+    // -- raw mt19937 output only, distributions differ between standard libraries
+    class Random {
+        std::mt19937 engine_;
+    public:
+        explicit Random( unsigned seed ) : engine_{ seed } { }
+        auto below( Size bound ) -> Size { return engine_( ) % bound; }
+        auto words( StringWordView pool, Size size ) -> StringWord {
+            StringWord words;
+            for ( Size i = 0; i < size; ++i ) words.push_back( pool[below( pool.size( ) )] );
+            return words;
+        }
+    };
+
+} // namespace
+
+#define SON8_CHECK( ... ) ::son8::cyrillic::test::check( static_cast< bool >( __VA_ARGS__ ), #__VA_ARGS__, __FILE__, __LINE__ )
+
+#endif//SON8_CYRILLIC_TEST_CHECK_HXX
+
+// Ⓒ 2026 Oleg'Ease'Kharchuk ᦒ
@@ -0,0 +1,42 @@
+#include "check.hxx"
+
+using namespace son8::cyrillic;
+using namespace son8::cyrillic::test;
+
+int main( ) {
+    Random random{ 7 };
+    Validate const validates[]{ Validate::None, Validate::IgnoreAll, Validate::AppendAll };
+    for ( auto language : Languages_ ) for ( auto validate : validates ) {
+        Codec const codec{ language, validate };
+        SON8_CHECK( codec.language( ) == language && codec.validate( ) == validate );
+        for ( int round = 0; round < 50; ++round ) {
+            auto const words = random.words( round % 3 ? Pool_Letters_ : Pool_Ascii_, random.below( 40 ) );
+            // thread state differs, codec must not read it
+            this_thread::state( language == Language::Russian ? Language::Ukrainian : Language::Russian );
+            this_thread::state( Validate::None );
+            StringByte out;
+            auto const code = codec.encode( out, words );
+            this_thread::state( language );
+            this_thread::state( validate );
+            StringByte expect;
+            SON8_CHECK( code == encode( expect, words ) && out == expect );
+            SON8_CHECK( codec.encoded_size( words ).written == encoded_size( words ).written );
+            SON8_CHECK( codec.can_encode( words ) == can_encode( words ) );
+            if ( code != Error::None ) continue;
+            StringWord back, expectBack;
+            SON8_CHECK( codec.decode( back, out ) == decode( expectBack, out ) && back == expectBack );
+            StringByte append{ "x" };
+            SON8_CHECK( codec.encode_append( append, words ) && append == "x" + out );
+        }
+    }
+    // captured once, later thread changes do not leak in
+    this_thread::state( Language::Russian );
+    this_thread::state( Validate::AppendAll );
+    Codec const captured;
+    this_thread::state( Language::Ukrainian );
+    this_thread::state( Validate::None );
+    StringByte out;
+    SON8_CHECK( captured.encode( out, u"Ї 1" ) == Error::None && out == "JXY 1" );
+    SON8_CHECK( this_thread::state_language( ) == Language::Ukrainian );
+    return finish( );
+}
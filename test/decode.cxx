@@ -0,0 +1,44 @@
+#include "check.hxx"
+
+using namespace son8::cyrillic;
+using namespace son8::cyrillic::test;
+
+int main( ) {
+    this_thread::state( Validate::None );
+    // j sequences read per language
+    this_thread::state( Language::Russian );
+    SON8_CHECK( decode( "Pruvet" ).ref( ) == u"Привет" );
+    SON8_CHECK( decode( "ji" ).ref( ) == u"ё" );
+    this_thread::state( Language::Ukrainian );
+    SON8_CHECK( decode( "ji" ).ref( ) == u"ї" );
+    SON8_CHECK( decode( "jxv" ).ref( ) == u"ё" );
+    // round trip of every letter under both languages, every api shape same output
+    Random random{ 2 };
+    for ( auto language : Languages_ ) {
+        this_thread::state( language );
+        for ( int round = 0; round < 200; ++round ) {
+            auto const words = random.words( Pool_Letters_, random.below( 64 ) );
+            auto const bytes = encode( words ).ref( );
+            StringWord out;
+            SON8_CHECK( decode( out, bytes ) == Error::None && out == words );
+            Error code{ Error::Language };
+            SON8_CHECK( decode( bytes, code ).ref( ) == words && code == Error::None );
+            SON8_CHECK( Decoded{ bytes }.ref( ) == words );
+            StringByte utf8;
+            SON8_CHECK( decode( utf8, bytes ) == Error::None && utf8 == string_byte( words ) );
+            SON8_CHECK( decoded_size( bytes ).written == words.size( ) );
+        }
+    }
+    // invalid and unfinished sequences
+    this_thread::state( Language::Russian );
+    StringWord out{ u"kept" };
+    SON8_CHECK( decode( out, "abj!" ) == Error::InvalidByte && out == u"kept" );
+    SON8_CHECK( decode( out, "abj" ) == Error::InvalidByte );
+    SON8_CHECK( decode( out, "jx" ) == Error::InvalidByte );
+    bool thrown = false;
+    try { Decoded{ "j" }; } catch ( Exception const &exception ) { thrown = exception.code( ) == Error::InvalidByte; }
+    SON8_CHECK( thrown );
+    this_thread::state( Language::None );
+    SON8_CHECK( decode( out, "a" ) == Error::Language );
+    return finish( );
+}
@@ -0,0 +1,59 @@
+#include "check.hxx"
+
+using namespace son8::cyrillic;
+using namespace son8::cyrillic::test;
+
+int main( ) {
+    // letters found in one language only decide
+    SON8_CHECK( detect( u"Съешь ещё" ) == Language::Russian );
+    SON8_CHECK( detect( u"Їжак з'їв ґудзик" ) == Language::Ukrainian );
+    SON8_CHECK( detect( u"Привет" ) == Language::None );
+    SON8_CHECK( detect( u"Привет", Language::Ukrainian ) == Language::Ukrainian );
+    SON8_CHECK( detect( u"ЁЇ", Language::Russian ) == Language::Russian );
+    SON8_CHECK( detect( StringByteView{ string_byte( u"Съешь ещё" ) } ) == Language::Russian );
+    SON8_CHECK( detect( StringByteView{ string_byte( u"ґанок" ) } ) == Language::Ukrainian );
+    // encoded text tells language by jx sequences only
+    SON8_CHECK( detect_encoded( "jqjuJXY" ) == Language::Russian );
+    SON8_CHECK( detect_encoded( "jxqjxuJI" ) == Language::Ukrainian );
+    SON8_CHECK( detect_encoded( "jqju" ) == Language::None );
+    this_thread::state( Validate::None );
+    Random random{ 13 };
+    for ( auto language : Languages_ ) {
+        auto const other = language == Language::Russian ? Pool_Ukrainian_ : Pool_Russian_;
+        auto const own = language == Language::Russian ? Pool_Russian_ : Pool_Ukrainian_;
+        Codec const codec{ language, Validate::None };
+        for ( int round = 0; round < 100; ++round ) {
+            // few foreign letters in own text, those are written with jx
+            auto words = random.words( own, 20 + random.below( 20 ) );
+            words.push_back( other[random.below( other.size( ) )] );
+            StringByte encoded;
+            SON8_CHECK( codec.encode( encoded, words ) == Error::None );
+            auto const found = detect_encoded( encoded );
+            SON8_CHECK( found == language || ( encoded.find( "jx" ) == StringByte::npos && encoded.find( "JX" ) == StringByte::npos ) );
+            // auto modes round trip whenever language is decided
+            Detect detected{ language };
+            StringWord back;
+            SON8_CHECK( decode( back, encoded, detected ) == Error::None && back == words );
+            SON8_CHECK( detected.detected == language );
+            Detect automatic{ };
+            StringByte again;
+            auto const code = encode( again, words, automatic );
+            SON8_CHECK( automatic.detected == detect( words ) );
+            if ( code != Error::None ) SON8_CHECK( code == Error::Language && automatic.detected == Language::None );
+            else if ( automatic.detected != Language::None ) {
+                StringByte expect;
+                SON8_CHECK( Codec{ automatic.detected, Validate::None }.encode( expect, words ) == Error::None && again == expect );
+            }
+        }
+    }
+    // undecided and language dependent output fails, output without such letters does not
+    Detect none{ };
+    StringByte out;
+    SON8_CHECK( encode( out, u"ЁЇ", none ) == Error::Language );
+    SON8_CHECK( encode( out, u"Привет", none ) == Error::None && out == "Pruvet" && none.detected == Language::None );
+    StringWord back;
+    SON8_CHECK( decode( back, "Podjqezd", none ) == Error::Language );
+    SON8_CHECK( decode( back, "Pruvet", none ) == Error::None && back == u"Привет" );
+    SON8_CHECK( decode( back, "JXYjqa", none ) == Error::None && none.detected == Language::Russian && back == u"Їъа" );
+    return finish( );
+}
@@ -0,0 +1,90 @@
+#include "check.hxx"
+
+using namespace son8::cyrillic;
+using namespace son8::cyrillic::test;
+
+int main( ) {
+    this_thread::state( Validate::None );
+    // known words, mixed letters spelled per language
+    this_thread::state( Language::Russian );
+    SON8_CHECK( encode( u"Привет" ).ref( ) == "Pruvet" );
+    SON8_CHECK( encode( u"Їжак" ).ref( ) == "JXYjzak" );
+    this_thread::state( Language::Ukrainian );
+    SON8_CHECK( encode( u"Їжак" ).ref( ) == "JIjzak" );
+    SON8_CHECK( encode( u"Подъезд" ).ref( ) == "Podjxqezd" );
+    // every api shape gives same output, utf-8 input same as utf-16
+    Random random{ 1 };
+    for ( auto language : Languages_ ) {
+        this_thread::state( language );
+        for ( int round = 0; round < 200; ++round ) {
+            auto const words = random.words( Pool_Letters_, random.below( 64 ) );
+            StringByte out;
+            SON8_CHECK( encode( out, words ) == Error::None );
+            Error code{ Error::Language };
+            SON8_CHECK( encode( words, code ).ref( ) == out && code == Error::None );
+            SON8_CHECK( encode( words ).ref( ) == out && this_thread::state_error( ) == Error::None );
+            SON8_CHECK( Encoded{ words }.ref( ) == out );
+            StringByte utf8;
+            SON8_CHECK( encode( utf8, string_byte( words ) ) == Error::None && utf8 == out );
+            SON8_CHECK( string_word( string_byte( words ) ) == words );
+        }
+    }
+    // ascii runs of any length and offset match units encoded one by one
+    this_thread::state( Language::Russian );
+    this_thread::state( Validate::None );
+    this_thread::state( ValidateFlagAppend{ ValidateFlags::Ascii_Range_Digit } );
+    this_thread::state( ValidateFlagIgnore{ ValidateFlags::Ascii_Symbol_Space } );
+    auto const digits = this_thread::state_validate( );
+    this_thread::state( ValidateFlagAppend{ ValidateFlags::Ascii_List_Text } );
+    this_thread::state( ValidateFlagAppend{ ValidateFlags::Ascii_Brackets_Round } );
+    Validate const validates[]{ Validate::AppendAll, Validate::IgnoreAll, digits, this_thread::state_validate( ) };
+    // -- last profile appends most of its pool, so long appended runs reach vector kernels
+    StringWordView const pools[]{ Pool_Ascii_, Pool_Ascii_, Pool_Ascii_, u"0123456789 .,:;!?()" };
+    for ( int round = 0; round < 400; ++round ) {
+        auto const pool = pools[round % 4];
+        auto const words = random.words( pool, random.below( 100 ) ) + random.words( Pool_Letters_, random.below( 3 ) ) + random.words( pool, random.below( 100 ) );
+        this_thread::state( validates[round % 4] );
+        StringByte expect;
+        bool valid = true;
+        for ( auto unit : words ) {
+            StringByte one;
+            valid = encode( one, StringWordView{ &unit, 1 } ) == Error::None && valid;
+            expect += one;
+        }
+        StringByte out;
+        SON8_CHECK( ( encode( out, words ) == Error::None ) == valid );
+        SON8_CHECK( not valid || out == expect );
+        StringByte utf8;
+        SON8_CHECK( ( encode( utf8, StringByteView{ string_byte( words ) } ) == Error::None ) == valid );
+        SON8_CHECK( not valid || utf8 == expect );
+    }
+    // validate decides what happens to units outside of tables
+    this_thread::state( Language::Russian );
+    this_thread::state( Validate::None );
+    StringByte out{ "kept" };
+    SON8_CHECK( encode( out, u"a Б" ) == Error::InvalidWord && out == "kept" );
+    bool thrown = false;
+    try { Encoded{ u"a Б" }; } catch ( Exception const &exception ) { thrown = exception.code( ) == Error::InvalidWord; }
+    SON8_CHECK( thrown );
+    ( void )encode( u"a Б" );
+    SON8_CHECK( this_thread::state_error( ) == Error::InvalidWord );
+    this_thread::state( Validate::AppendAll );
+    SON8_CHECK( encode( u"a Б1" ).ref( ) == "xa B1" );
+    this_thread::state( Validate::IgnoreAll );
+    SON8_CHECK( encode( u"a Б1" ).ref( ) == "B" );
+    this_thread::state( Validate::None );
+    this_thread::state( ValidateFlagAppend{ ValidateFlags::Ascii_Range_Digit } );
+    this_thread::state( ValidateFlagIgnore{ ValidateFlags::Ascii_Symbol_Space } );
+    SON8_CHECK( encode( u"Б 1" ).ref( ) == "B1" );
+    SON8_CHECK( this_thread::state_validate( ) != Validate::None );
+    // no language, nothing to encode with
+    this_thread::state( Language::None );
+    SON8_CHECK( encode( out, u"Б" ) == Error::Language );
+    // malformed utf-8 input
+    this_thread::state( Language::Russian );
+    SON8_CHECK( encode( out, StringByteView{ "\xD0" } ) == Error::ConvertFailed );
+    StringWord words;
+    auto const result = string_word( words, StringByteView{ "ab\xFF" } );
+    SON8_CHECK( result.code == Error::ConvertFailed && result.read == 2 );
+    return finish( );
+}
@@ -0,0 +1,43 @@
+#include "check.hxx"
+
+using namespace son8::cyrillic;
+using namespace son8::cyrillic::test;
+
+// literals are checked by compiler, failure would not compile
+constexpr auto Encoded_Ru_ = u"Привет"_cyr_ru;
+constexpr auto Encoded_Ua_ = u"Їжак"_cyr_ua;
+constexpr auto Decoded_Ua_ = "JIjzak"_cyr_ua;
+static_assert( Encoded_Ru_.view( ) == "Pruvet" );
+static_assert( Encoded_Ua_.view( ) == "JIjzak" );
+static_assert( Decoded_Ua_.view( ) == u"Їжак" );
+static_assert( encode_fixed< 4 >( u"Привет", Language::Russian ).code( ) == Error::OutputOverflow );
+static_assert( encode_fixed< 8 >( u"a", Language::Russian ).code( ) == Error::InvalidWord );
+static_assert( decode_fixed< 8 >( "j", Language::Russian ).code( ) == Error::InvalidByte );
+
+int main( ) {
+    Random random{ 8 };
+    Validate const validates[]{ Validate::None, Validate::IgnoreAll, Validate::AppendAll };
+    // header-only engine agrees with compiled one
+    for ( auto language : Languages_ ) for ( auto validate : validates ) {
+        Codec const codec{ language, validate };
+        for ( int round = 0; round < 100; ++round ) {
+            auto const words = random.words( round % 3 ? Pool_Letters_ : Pool_Ascii_, random.below( 40 ) );
+            StringByte out;
+            auto const code = codec.encode( out, words );
+            auto const fixed = encode_fixed< 128 >( words, language, validate );
+            SON8_CHECK( fixed.code( ) == code );
+            if ( code != Error::None ) continue;
+            SON8_CHECK( fixed.view( ) == out );
+            // -- appended ascii is not decodable by either engine
+            auto const back = decode_fixed< 64 >( out, language );
+            StringWord expect;
+            SON8_CHECK( back.code( ) == codec.decode( expect, out ) );
+            SON8_CHECK( not back || back.view( ) == expect );
+        }
+    }
+    // run time literal failure throws
+    bool thrown = false;
+    try { auto const broken = u"a"_cyr_ru; ( void )broken; } catch ( Exception const &exception ) { thrown = exception.code( ) == Error::InvalidWord; }
+    SON8_CHECK( thrown );
+    return finish( );
+}
@@ -0,0 +1,63 @@
+#include "check.hxx"
+// std headers
+#include <thread>
+#include <vector>
+
+using namespace son8::cyrillic;
+using namespace son8::cyrillic::test;
+
+int main( ) {
+    this_thread::state( Validate::None );
+    Random random{ 6 };
+    Parallel const parallel{ 4, 1024 };
+    for ( auto language : Languages_ ) {
+        this_thread::state( language );
+        for ( int round = 0; round < 8; ++round ) {
+            // chunks split across utf-8 and j sequences must join into serial output
+            auto const words = random.words( Pool_Letters_, 3000 + random.below( 20000 ) );
+            auto const utf8 = string_byte( words );
+            auto const bytes = encode( words ).ref( );
+            StringByte out;
+            SON8_CHECK( encode( out, words, parallel ) == Error::None && out == bytes );
+            out.clear( );
+            SON8_CHECK( encode( out, StringByteView{ utf8 }, parallel ) == Error::None && out == bytes );
+            StringWord back;
+            SON8_CHECK( decode( back, bytes, parallel ) == Error::None && back == words );
+            StringByte narrow;
+            SON8_CHECK( decode( narrow, bytes, parallel ) == Error::None && narrow == utf8 );
+            // failure anywhere reports serial error and leaves out untouched
+            auto broken = words;
+            broken[random.below( broken.size( ) )] = u'!';
+            out = "kept";
+            SON8_CHECK( encode( out, broken, parallel ) == Error::InvalidWord && out == "kept" );
+            auto corrupt = bytes;
+            corrupt[random.below( corrupt.size( ) )] = '!';
+            SON8_CHECK( decode( back, corrupt, parallel ) == Error::InvalidByte );
+        }
+    }
+    // pooled workers shared by concurrent callers with own thread settings and growing thread counts
+    std::vector< std::thread > callers;
+    std::vector< int > passed( 4, 0 );
+    for ( unsigned caller = 0; caller < passed.size( ); ++caller ) callers.emplace_back( [caller,&passed] {
+        this_thread::state( Languages_[caller % 2] );
+        this_thread::state( Validate::None );
+        Random random{ 60 + caller };
+        for ( int round = 0; round < 20; ++round ) {
+            auto const words = random.words( Pool_Letters_, 2000 + random.below( 6000 ) );
+            auto const bytes = encode( words ).ref( );
+            StringByte out;
+            StringWord back;
+            Parallel const wide{ 2 + ( caller + unsigned( round ) ) % 7, 256 };
+            auto const ok = encode( out, words, wide ) == Error::None && out == bytes
+                         && decode( back, bytes, wide ) == Error::None && back == words;
+            passed[caller] += ok;
+        }
+    } );
+    for ( auto &caller : callers ) caller.join( );
+    for ( auto count : passed ) SON8_CHECK( count == 20 );
+    // small input and default settings stay correct
+    this_thread::state( Language::Russian );
+    StringByte out;
+    SON8_CHECK( encode( out, u"Привет", Parallel{ } ) == Error::None && out == "Pruvet" );
+    return finish( );
+}
@@ -0,0 +1,53 @@
+#include "check.hxx"
+// std headers
+#include <memory_resource>
+
+using namespace son8::cyrillic;
+using namespace son8::cyrillic::test;
+
+namespace {
+    // counts allocations reaching caller resource
+    class Counting final : public std::pmr::memory_resource {
+        std::pmr::memory_resource *upstream_{ std::pmr::new_delete_resource( ) };
+        auto do_allocate( Size bytes, Size align ) -> void * override { return ++allocations, upstream_->allocate( bytes, align ); }
+        void do_deallocate( void *data, Size bytes, Size align ) override { upstream_->deallocate( data, bytes, align ); }
+        auto do_is_equal( std::pmr::memory_resource const &other ) const noexcept -> bool override { return this == &other; }
+    public:
+        Size allocations{ 0 };
+    };
+}
+
+int main( ) {
+    this_thread::state( Language::Russian );
+    this_thread::state( Validate::None );
+    Random random{ 9 };
+    Counting resource;
+    for ( int round = 0; round < 100; ++round ) {
+        // long enough to leave small string buffer
+        auto const words = random.words( Pool_Letters_, 40 + random.below( 40 ) );
+        auto const encoded = encode( words );
+        StringByteView const bytes{ encoded };
+        auto const before = resource.allocations;
+        StringBytePmr out{ &resource };
+        SON8_CHECK( encode( out, words ) == Error::None && StringByteView{ out } == bytes );
+        SON8_CHECK( out.get_allocator( ).resource( ) == &resource && resource.allocations > before );
+        StringBytePmr utf8{ &resource };
+        SON8_CHECK( encode( utf8, StringByteView{ string_byte( words ) } ) == Error::None && StringByteView{ utf8 } == bytes );
+        Error code{ Error::Language };
+        auto const owned = encode( words, code, &resource );
+        SON8_CHECK( code == Error::None && StringByteView{ owned.ref( ) } == bytes && owned.ref( ).get_allocator( ).resource( ) == &resource );
+        SON8_CHECK( StringByteView{ encode( words, &resource ).ref( ) } == bytes );
+        StringBytePmr append{ &resource };
+        SON8_CHECK( encode_append( append, words ) && StringByteView{ append } == bytes );
+        // decode side
+        StringWordPmr back{ &resource };
+        SON8_CHECK( decode( back, bytes ) == Error::None && StringWordView{ back } == words );
+        SON8_CHECK( StringWordView{ decode( bytes, code, &resource ).ref( ) } == words && code == Error::None );
+        SON8_CHECK( decode( bytes, &resource ).ref( ).get_allocator( ).resource( ) == &resource );
+        StringBytePmr narrow{ &resource };
+        SON8_CHECK( decode( narrow, bytes ) == Error::None && StringByteView{ narrow } == string_byte( words ) );
+        SON8_CHECK( StringByteView{ EncodedPmr{ words, &resource }.ref( ) } == bytes );
+        SON8_CHECK( StringWordView{ DecodedPmr{ bytes, &resource }.ref( ) } == words );
+    }
+    return finish( );
+}
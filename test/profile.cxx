@@ -0,0 +1,57 @@
+#include "check.hxx"
+// std headers
+#include <memory>
+#include <vector>
+
+using namespace son8::cyrillic;
+using namespace son8::cyrillic::test;
+
+int main( ) {
+    this_thread::state( Language::Russian );
+    Random random{ 11 };
+    ValidateProfile const digits{ { ValidateFlags::Ascii_Range_Digit, ValidateFlags::Ascii_List_Text }, { ValidateFlags::Ascii_Symbol_Space } };
+    // same output as flags set one by one on thread
+    this_thread::state( Validate::None );
+    this_thread::state( ValidateFlagAppend{ ValidateFlags::Ascii_Range_Digit } );
+    this_thread::state( ValidateFlagAppend{ ValidateFlags::Ascii_List_Text } );
+    this_thread::state( ValidateFlagIgnore{ ValidateFlags::Ascii_Symbol_Space } );
+    auto const mask = this_thread::state_validate( );
+    SON8_CHECK( digits.validate( ) == mask );
+    SON8_CHECK( digits.appends( )['7'] && digits.appends( )['!'] && digits.ignores( )[' '] && not digits.appends( )['a'] );
+    Codec const codec{ Language::Russian, digits };
+    for ( int round = 0; round < 300; ++round ) {
+        auto const words = random.words( round % 2 ? Pool_Ascii_ : Pool_Letters_, random.below( 30 ) ) + random.words( Pool_Letters_, 4 );
+        this_thread::state( mask );
+        StringByte byMask, byProfile, byCodec;
+        auto const code = encode( byMask, words );
+        this_thread::state( digits );
+        SON8_CHECK( encode( byProfile, words ) == code && byProfile == byMask );
+        SON8_CHECK( codec.encode( byCodec, words ) == code && byCodec == byMask );
+        SON8_CHECK( this_thread::state_validate( ) == mask );
+    }
+    // selecting mask after profile drops profile
+    this_thread::state( digits );
+    this_thread::state( Validate::None );
+    SON8_CHECK( encode( u"Б 1" ).ref( ).empty( ) && this_thread::state_error( ) == Error::InvalidWord );
+    // flag changed on top of profile starts from profile flags
+    this_thread::state( digits );
+    this_thread::state( ValidateFlagAppend{ ValidateFlags::Ascii_Range_Lower } );
+    SON8_CHECK( encode( u"Б 1a" ).ref( ) == "B1xa" );
+    // plain validate profile matches specials
+    ValidateProfile const all{ Validate::AppendAll };
+    this_thread::state( all );
+    SON8_CHECK( encode( u"Б 1a" ).ref( ) == "B 1xa" );
+    // temporary profile selected then destroyed, tables live on thread
+    this_thread::state( ValidateProfile{ { ValidateFlags::Ascii_Range_Digit, ValidateFlags::Ascii_List_Text }, { ValidateFlags::Ascii_Symbol_Space } } );
+    {
+        std::vector< ValidateProfile > reuse( 8, ValidateProfile{ Validate::None } ); // heap slots likely reused
+        SON8_CHECK( reuse.size( ) == 8 );
+    }
+    SON8_CHECK( encode( u"Б 1" ).ref( ) == "B1" );
+    {
+        auto scoped = std::make_unique< ValidateProfile >( Validate::AppendAll );
+        this_thread::state( *scoped );
+    }
+    SON8_CHECK( encode( u"Б 1a" ).ref( ) == "B 1xa" );
+    return finish( );
+}
@@ -0,0 +1,41 @@
+#include "check.hxx"
+
+using namespace son8::cyrillic;
+using namespace son8::cyrillic::test;
+
+int main( ) {
+    Random random{ 15 };
+    for ( auto from : Languages_ ) for ( auto to : Languages_ ) {
+        Codec const source{ from, Validate::None };
+        Codec const target{ to, Validate::None };
+        for ( int round = 0; round < 300; ++round ) {
+            // same as decode with from and encode with to
+            auto const words = random.words( Pool_Letters_, random.below( 80 ) );
+            StringByte in, expect, out;
+            SON8_CHECK( source.encode( in, words ) == Error::None && target.encode( expect, words ) == Error::None );
+            SON8_CHECK( reencode( out, in, from, to ) == Error::None && out == expect );
+            StringByte append{ "x" };
+            SON8_CHECK( reencode_append( append, in, from, to ) && append == "x" + expect );
+            // broken input fails where decode fails, output equal wherever decode succeeds
+            auto broken = in;
+            if ( not broken.empty( ) ) broken[random.below( broken.size( ) )] = "jJxX!q"[random.below( 6 )];
+            StringWord decoded;
+            if ( source.decode( decoded, broken ) == Error::None ) {
+                SON8_CHECK( target.encode( expect, decoded ) == Error::None );
+                SON8_CHECK( reencode( out, broken, from, to ) == Error::None && out == expect );
+            }
+        }
+    }
+    // only j sequences rewritten, appended ascii copied as is
+    StringByte out;
+    SON8_CHECK( reencode( out, "JXYjzak xj, 1", Language::Russian, Language::Ukrainian ) == Error::None && out == "JIjzak xj, 1" );
+    SON8_CHECK( reencode( out, "JIjzak", Language::Ukrainian, Language::Russian ) == Error::None && out == "JXYjzak" );
+    // broken sequences fail with offset of sequence
+    out = "kept";
+    SON8_CHECK( reencode( out, "ab j!", Language::Russian, Language::Ukrainian ) == Error::InvalidByte && out == "kept" );
+    StringByte append;
+    auto const result = reencode_append( append, "abjx", Language::Russian, Language::Ukrainian );
+    SON8_CHECK( result.code == Error::InvalidByte && result.read == 2 && append == "ab" );
+    SON8_CHECK( reencode( out, "a", Language::None, Language::Russian ) == Error::Language );
+    return finish( );
+}
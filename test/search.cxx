@@ -0,0 +1,56 @@
+#include "check.hxx"
+// std headers
+#include <vector>
+
+using namespace son8::cyrillic;
+using namespace son8::cyrillic::test;
+
+int main( ) {
+    this_thread::state( Validate::None );
+    Random random{ 12 };
+    constexpr StringWordView pool{ u"аёжЖїЇъо" }; // small pool for frequent matches
+    for ( auto language : Languages_ ) {
+        this_thread::state( language );
+        for ( int round = 0; round < 300; ++round ) {
+            std::vector< StringWord > queries;
+            for ( auto count = 1 + random.below( 3 ); count; --count ) queries.push_back( random.words( pool, 1 + random.below( 3 ) ) );
+            std::vector< StringWordView > views( queries.begin( ), queries.end( ) );
+            Search const search{ views };
+            auto const words = random.words( pool, random.below( 60 ) );
+            auto const text = encode( words ).ref( );
+            // reference is greedy search in decoded text, longest query at earliest offset
+            SearchMatch match = search.find( text );
+            Size at = 0;
+            for ( ;; ) {
+                Size best = words.size( ), size = 0;
+                for ( Size i = at; i < words.size( ) && best == words.size( ); ++i ) {
+                    for ( auto const &query : queries ) {
+                        if ( StringWordView{ words }.substr( i, query.size( ) ) == query && query.size( ) > size ) best = i, size = query.size( );
+                    }
+                }
+                if ( size == 0 ) {
+                    SON8_CHECK( not match );
+                    break;
+                }
+                SON8_CHECK( match && match.decoded_offset == best && match.decoded_size == size );
+                SON8_CHECK( queries[match.pattern].size( ) == size );
+                SON8_CHECK( StringByteView{ text }.substr( match.offset, match.size ) == search.pattern( match.pattern ) );
+                SON8_CHECK( decoded_offset( text, match.offset ) == best && encoded_offset( text, best ) == match.offset );
+                if ( not match ) break;
+                at = best + size;
+                match = search.find( text, match );
+            }
+            SON8_CHECK( search.contains( text ) == bool( search.find( text ) ) );
+        }
+    }
+    // offset map ends at text size
+    this_thread::state( Language::Russian );
+    auto const text = encode( u"ёжа" ).ref( );
+    SON8_CHECK( decoded_offset( text, text.size( ) ) == 3 && encoded_offset( text, 3 ) == text.size( ) );
+    SON8_CHECK( encoded_offset( text, 1 ) == 2 && encoded_offset( text, 2 ) == 4 );
+    // codec decides how queries are encoded
+    Codec const ukrainian{ Language::Ukrainian, Validate::None };
+    Search const search{ ukrainian, { u"ї" } };
+    SON8_CHECK( search.pattern( 0 ) == "ji" && search.size( ) == 1 );
+    return finish( );
+}
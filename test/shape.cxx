@@ -0,0 +1,91 @@
+#include "check.hxx"
+// std headers
+#include <vector>
+
+using namespace son8::cyrillic;
+using namespace son8::cyrillic::test;
+
+int main( ) {
+    this_thread::state( Language::Russian );
+    this_thread::state( Validate::None );
+    Random random{ 3 };
+    for ( int round = 0; round < 200; ++round ) {
+        auto const words = random.words( Pool_Letters_, 1 + random.below( 64 ) );
+        auto const bytes = encode( words ).ref( );
+        // size measures exactly what encode writes
+        SON8_CHECK( encoded_size( words ).written == bytes.size( ) );
+        SON8_CHECK( encoded_size( StringByteView{ string_byte( words ) } ).written == bytes.size( ) );
+        // span fits exactly, one byte less overflows and resumes with fresh buffer
+        std::vector< char > span( bytes.size( ) );
+        auto const fit = encode( span.data( ), span.size( ), words );
+        SON8_CHECK( fit && fit.written == bytes.size( ) && StringByteView( span.data( ), span.size( ) ) == bytes );
+        auto const half = encode( span.data( ), bytes.size( ) / 2, words );
+        SON8_CHECK( half.code == Error::OutputOverflow && half.read < words.size( ) );
+        StringByte joined{ span.data( ), half.written };
+        auto const rest = encode( span.data( ), span.size( ), words, half.read );
+        SON8_CHECK( rest && rest.read == words.size( ) );
+        joined.append( span.data( ), rest.written );
+        SON8_CHECK( joined == bytes );
+        // decode span in char16_t and utf-8 units
+        std::vector< char16_t > wide( words.size( ) );
+        auto const back = decode( wide.data( ), wide.size( ), bytes );
+        SON8_CHECK( back && StringWordView( wide.data( ), back.written ) == words );
+        std::vector< char > utf8( words.size( ) * 2 );
+        auto const narrow = decode( utf8.data( ), utf8.size( ), bytes );
+        SON8_CHECK( narrow && StringByteView( utf8.data( ), narrow.written ) == string_byte( words ) );
+        SON8_CHECK( decode( wide.data( ), wide.size( ) - 1, bytes ).code == Error::OutputOverflow );
+    }
+    // append resumed past each failure counts same units as count_invalid and skips them like IgnoreAll
+    for ( int round = 0; round < 200; ++round ) {
+        auto const words = random.words( round % 2 ? Pool_Letters_ : Pool_Ascii_, random.below( 48 ) ) + random.words( Pool_Letters_, random.below( 16 ) );
+        StringByte out;
+        Size failed = 0;
+        for ( Size from = 0; ; ) {
+            auto const result = encode_append( out, words, from );
+            if ( result ) break;
+            SON8_CHECK( result.code == Error::InvalidWord );
+            ++failed, from = result.read + 1;
+        }
+        SON8_CHECK( failed == count_invalid( words ) );
+        SON8_CHECK( can_encode( words ) == ( failed == 0 ) );
+        this_thread::state( Validate::IgnoreAll );
+        SON8_CHECK( out == encode( words ).ref( ) );
+        this_thread::state( Validate::None );
+        // utf-8 resumes past whole rejected code point or single malformed byte
+        auto bytes = string_byte( words + u"€" );
+        for ( auto plant = random.below( 3 ); plant; --plant ) bytes[random.below( bytes.size( ) )] = '\xFF';
+        Size failed_utf8 = 0;
+        for ( Size from = 0; ; ) {
+            auto const result = encode_append( out, StringByteView{ bytes }, from );
+            if ( result ) break;
+            auto const lead = static_cast< unsigned char >( bytes[result.read] );
+            Size const skip = result.code == Error::ConvertFailed || lead < 0x80u ? 1 : lead < 0xE0u ? 2 : lead < 0xF0u ? 3 : 4;
+            ++failed_utf8, from = result.read + skip;
+        }
+        SON8_CHECK( failed_utf8 == count_invalid_utf8( bytes ) );
+        SON8_CHECK( can_encode( StringByteView{ bytes } ) == ( failed_utf8 == 0 ) );
+    }
+    // same for decode, broken bytes planted into valid text
+    for ( int round = 0; round < 200; ++round ) {
+        auto bytes = encode( random.words( Pool_Letters_, 1 + random.below( 48 ) ) ).ref( );
+        for ( auto plant = random.below( 4 ); plant; --plant ) bytes[random.below( bytes.size( ) )] = "!j0 "[random.below( 4 )];
+        StringWord out;
+        Size failed = 0;
+        for ( Size from = 0; ; ) {
+            auto const result = decode_append( out, bytes, from );
+            if ( result ) break;
+            SON8_CHECK( result.code == Error::InvalidByte );
+            ++failed, from = result.read + 1;
+        }
+        SON8_CHECK( failed == count_invalid( StringByteView{ bytes } ) );
+        SON8_CHECK( can_decode( bytes ) == ( failed == 0 ) );
+    }
+    // append extends, failure keeps output before invalid unit
+    StringByte out{ "x" };
+    auto const result = encode_append( out, u"Аб!в" );
+    SON8_CHECK( result.code == Error::InvalidWord && result.read == 2 && result.written == 2 && out == "xAb" );
+    // no language rejects every code point
+    this_thread::state( Language::None );
+    SON8_CHECK( count_invalid_utf8( StringByteView{ "\xD0\x91" "1\xFF" } ) == 3 && count_invalid( u"Б1" ) == 2 );
+    return finish( );
+}
@@ -0,0 +1,38 @@
+#include "check.hxx"
+// std headers
+#include <thread>
+
+using namespace son8::cyrillic;
+using namespace son8::cyrillic::test;
+
+int main( ) {
+    // defaults, nothing selected
+    SON8_CHECK( this_thread::state_language( ) == Language::None );
+    SON8_CHECK( this_thread::state_validate( ) == Validate::None );
+    SON8_CHECK( this_thread::state_error( ) == Error::None );
+    // setters and getters
+    this_thread::state( Language::Ukrainian );
+    this_thread::state( Validate::AppendAll );
+    SON8_CHECK( this_thread::state_language( ) == Language::Ukrainian );
+    SON8_CHECK( this_thread::state_validate( ) == Validate::AppendAll );
+    this_thread::state( ValidateFlagZeroed{ ValidateFlags::Ascii_Range_Digit } );
+    SON8_CHECK( this_thread::state_validate( ) != Validate::AppendAll );
+    SON8_CHECK( encode( u"1" ).ref( ).empty( ) && this_thread::state_error( ) == Error::InvalidWord );
+    SON8_CHECK( encode( u"a" ).ref( ) == "xa" && this_thread::state_error( ) == Error::None );
+    this_thread::state( static_cast< ValidateVeiled >( Validate::IgnoreAll ) );
+    SON8_CHECK( this_thread::state_validate( ) == Validate::IgnoreAll );
+    SON8_CHECK( this_thread::state_validate_veiled( ) == static_cast< ValidateVeiled >( Validate::IgnoreAll ) );
+    // state is per thread
+    std::thread{ [] {
+        SON8_CHECK( this_thread::state_language( ) == Language::None );
+        this_thread::state( Language::Russian );
+        SON8_CHECK( encode( u"Ї" ).ref( ) == "JXY" );
+    } }.join( );
+    SON8_CHECK( this_thread::state_language( ) == Language::Ukrainian && encode( u"Ї" ).ref( ) == "JI" );
+    // error message for every code
+    for ( unsigned code = 0; code < static_cast< unsigned >( Error::Size_ ); ++code ) {
+        SON8_CHECK( error_message( static_cast< Error >( code ) ) != nullptr );
+    }
+    SON8_CHECK( StringByteView{ Exception{ Error::InvalidByte }.what( ) } == error_message( Error::InvalidByte ) );
+    return finish( );
+}
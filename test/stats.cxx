@@ -0,0 +1,74 @@
+#include "check.hxx"
+// std headers
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace son8::cyrillic;
+using namespace son8::cyrillic::test;
+
+namespace {
+#ifdef SON8_CYRILLIC_NO_STATS
+    constexpr bool Enabled_ = false;
+#else
+    constexpr bool Enabled_ = true;
+#endif
+    auto delta( Size before, Size after, Size expect ) -> bool { return after - before == ( Enabled_ ? expect : 0 ); }
+}
+
+int main( ) {
+    this_thread::state( Language::Russian );
+    this_thread::state( Validate::None );
+    using Kind = StatsKind;
+    using Shape = StatsShape;
+    // each shape counted once per call with bytes read and written
+    auto before = this_thread::stats( );
+    StringByte out;
+    SON8_CHECK( encode( out, u"Привет" ) == Error::None );
+    auto after = this_thread::stats( );
+    SON8_CHECK( delta( before.call( Kind::Encode, Shape::String ), after.call( Kind::Encode, Shape::String ), 1 ) );
+    SON8_CHECK( delta( before.input[0], after.input[0], 12 ) && delta( before.output[0], after.output[0], 6 ) );
+    before = after;
+    ( void )encode_append( out, u"Б" );
+    ( void )encoded_size( u"Б" );
+    ( void )can_encode( u"Б" );
+    StringWord back;
+    SON8_CHECK( decode( back, "Pruvet" ) == Error::None );
+    after = this_thread::stats( );
+    SON8_CHECK( delta( before.call( Kind::Encode, Shape::Append ), after.call( Kind::Encode, Shape::Append ), 1 ) );
+    SON8_CHECK( delta( before.call( Kind::Encode, Shape::Size ), after.call( Kind::Encode, Shape::Size ), 1 ) );
+    SON8_CHECK( delta( before.call( Kind::Encode, Shape::Check ), after.call( Kind::Encode, Shape::Check ), 1 ) );
+    SON8_CHECK( delta( before.call( Kind::Decode, Shape::String ), after.call( Kind::Decode, Shape::String ), 1 ) );
+    SON8_CHECK( delta( before.output[1], after.output[1], 12 ) );
+    // failures counted by error
+    before = after;
+    SON8_CHECK( encode( out, u"!" ) == Error::InvalidWord );
+    after = this_thread::stats( );
+    SON8_CHECK( delta( before.error( Error::InvalidWord ), after.error( Error::InvalidWord ), 1 ) );
+    // finished threads stay in global snapshot
+    auto const global = stats( );
+    std::thread{ [] { ( void )encoded_size( u"Б" ); } }.join( );
+    SON8_CHECK( delta( global.call( Kind::Encode, Shape::Size ), stats( ).call( Kind::Encode, Shape::Size ), 1 ) );
+    // threads leaving in any order keep live and retired counters exact
+    auto const start = stats( );
+    std::atomic< int > ready{ 0 };
+    std::vector< std::atomic< bool > > leave( 4 );
+    std::vector< std::thread > threads;
+    for ( Size index = 0; index < leave.size( ); ++index ) threads.emplace_back( [index,&ready,&leave] {
+        for ( Size call = 0; call <= index; ++call ) ( void )encoded_size( u"Б" );
+        ++ready;
+        while ( not leave[index] ) std::this_thread::yield( );
+    } );
+    while ( ready != 4 ) std::this_thread::yield( );
+    SON8_CHECK( delta( start.call( Kind::Encode, Shape::Size ), stats( ).call( Kind::Encode, Shape::Size ), 10 ) );
+    for ( Size index : { 1, 3, 0, 2 } ) {
+        leave[index] = true;
+        threads[index].join( );
+        SON8_CHECK( delta( start.call( Kind::Encode, Shape::Size ), stats( ).call( Kind::Encode, Shape::Size ), 10 ) );
+    }
+    // sum of snapshots
+    Stats sum = before;
+    sum += before;
+    SON8_CHECK( sum.call( Kind::Encode, Shape::String ) == 2 * before.call( Kind::Encode, Shape::String ) );
+    return finish( );
+}
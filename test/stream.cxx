@@ -0,0 +1,65 @@
+#include "check.hxx"
+
+using namespace son8::cyrillic;
+using namespace son8::cyrillic::test;
+
+int main( ) {
+    this_thread::state( Validate::None );
+    Random random{ 4 };
+    for ( auto language : Languages_ ) {
+        this_thread::state( language );
+        for ( int round = 0; round < 100; ++round ) {
+            auto const words = random.words( Pool_Letters_, random.below( 40 ) );
+            auto const utf8 = string_byte( words );
+            auto const bytes = encode( words ).ref( );
+            // any split point gives whole output, also inside utf-8 and j sequences
+            auto const cut = [&random]( Size size ) { return size ? random.below( size + 1 ) : 0; };
+            Encoder encoder{ language, Validate::None };
+            StringByte sink;
+            auto const w = cut( words.size( ) );
+            SON8_CHECK( encoder.feed( sink, StringWordView{ words }.substr( 0, w ) ) == Error::None );
+            SON8_CHECK( encoder.feed( sink, StringWordView{ words }.substr( w ) ) == Error::None );
+            SON8_CHECK( encoder.finish( ) == Error::None && sink == bytes );
+            sink.clear( );
+            for ( Size i = 0; i < utf8.size( ); ++i ) SON8_CHECK( encoder.feed( sink, StringByteView{ utf8 }.substr( i, 1 ) ) == Error::None );
+            SON8_CHECK( encoder.finish( ) == Error::None && sink == bytes );
+            Decoder decoder{ language };
+            StringWord out;
+            for ( Size i = 0; i < bytes.size( ); ++i ) SON8_CHECK( decoder.feed( out, StringByteView{ bytes }.substr( i, 1 ) ) == Error::None );
+            SON8_CHECK( decoder.finish( ) == Error::None && out == words );
+            StringByte narrow;
+            auto const b = cut( bytes.size( ) );
+            SON8_CHECK( decoder.feed( narrow, StringByteView{ bytes }.substr( 0, b ) ) == Error::None );
+            SON8_CHECK( decoder.feed( narrow, StringByteView{ bytes }.substr( b ) ) == Error::None );
+            SON8_CHECK( decoder.finish( ) == Error::None && narrow == utf8 );
+        }
+    }
+    // unfinished input fails on finish, which resets for next stream
+    Encoder encoder{ Language::Russian, Validate::None };
+    StringByte sink;
+    SON8_CHECK( encoder.feed( sink, StringByteView{ "\xD0" } ) == Error::None );
+    SON8_CHECK( encoder.finish( ) != Error::None );
+    SON8_CHECK( encoder.feed( sink, u"Б" ) == Error::None && encoder.finish( ) == Error::None && sink == "B" );
+    SON8_CHECK( encoder.feed( sink, u" " ) == Error::InvalidWord );
+    // validate tables captured once, every feed and default constructed encoder honour them
+    Encoder appending{ Language::Russian, Validate::AppendAll };
+    sink.clear( );
+    SON8_CHECK( appending.feed( sink, u"Б 1" ) == Error::None && appending.feed( sink, StringByteView{ "a" } ) == Error::None );
+    SON8_CHECK( appending.finish( ) == Error::None && sink == "B 1xa" );
+    this_thread::state( Language::Russian );
+    this_thread::state( Validate::AppendAll );
+    Encoder captured;
+    this_thread::state( Validate::None );
+    sink.clear( );
+    SON8_CHECK( captured.feed( sink, u"Б 1a" ) == Error::None && sink == "B 1xa" );
+    Decoder decoder{ Language::Russian };
+    StringWord out;
+    SON8_CHECK( decoder.feed( out, "j" ) == Error::None && decoder.finish( ) == Error::InvalidByte );
+    SON8_CHECK( decoder.feed( out, "ja" ) == Error::None && decoder.finish( ) == Error::None && out == u"я" );
+    // invalid byte drops sequence it broke, stream goes on from clean state
+    SON8_CHECK( decoder.feed( out, "j" ) == Error::None && decoder.feed( out, "!" ) == Error::InvalidByte );
+    SON8_CHECK( decoder.finish( ) == Error::None && decoder.feed( out, "jaj" ) == Error::None );
+    SON8_CHECK( decoder.feed( out, "!" ) == Error::InvalidByte && decoder.feed( out, "ja" ) == Error::None );
+    SON8_CHECK( decoder.finish( ) == Error::None && out == u"яяя" );
+    return finish( );
+}
@@ -0,0 +1,78 @@
+#include "check.hxx"
+// std headers
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+using namespace son8::cyrillic;
+using namespace son8::cyrillic::test;
+
+int main( ) {
+    this_thread::state( Language::Russian );
+    this_thread::state( Validate::AppendAll );
+    Random random{ 14 };
+    for ( int round = 0; round < 500; ++round ) {
+        // longer than one chunk of iterator buffer half of time
+        auto const a = random.words( round % 3 ? Pool_Letters_ : Pool_Ascii_, random.below( 150 ) );
+        auto const b = round % 4 ? random.words( Pool_Letters_, random.below( 150 ) ) : a.substr( 0, random.below( a.size( ) + 1 ) );
+        auto const ea = encode( a ).ref( );
+        auto const eb = encode( b ).ref( );
+        EncodeView const va{ a };
+        EncodeView const vb{ b };
+        // walked output and algorithms agree with materialized strings
+        SON8_CHECK( StringByte( va.begin( ), va.end( ) ) == ea );
+        SON8_CHECK( va.check( ).written == ea.size( ) );
+        SON8_CHECK( view_hash( va ) == view_hash( ea ) );
+        auto const order = view_compare( va, vb );
+        auto const expect = ea.compare( eb );
+        SON8_CHECK( ( order < 0 ) == ( expect < 0 ) && ( order == 0 ) == ( expect == 0 ) );
+        SON8_CHECK( view_compare( va, eb ) == order && view_compare( ea, vb ) == order );
+        SON8_CHECK( view_equal( va, vb ) == ( ea == eb ) );
+        SON8_CHECK( view_starts_with( va, vb ) == ( ea.compare( 0, eb.size( ), eb ) == 0 && eb.size( ) <= ea.size( ) ) );
+        auto const utf8 = string_byte( a );
+        SON8_CHECK( view_equal( EncodeViewUtf8{ utf8 }, ea ) );
+        // decode views, output ends where decode_append stops
+        StringWord words;
+        StringByte narrow;
+        ( void )decode_append( words, ea );
+        ( void )decode_append( narrow, ea );
+        DecodeView const dv{ ea };
+        SON8_CHECK( StringWord( dv.begin( ), dv.end( ) ) == words && view_hash( dv ) == view_hash( words ) );
+        SON8_CHECK( view_equal( DecodeViewUtf8{ ea }, narrow ) );
+    }
+    // input failure ends output and is reported by iterator and check
+    this_thread::state( Validate::None );
+    EncodeView const broken{ u"абв!где" };
+    auto it = broken.begin( );
+    StringByte walked;
+    for ( ; it != broken.end( ); ++it ) walked += *it;
+    SON8_CHECK( walked == "abv" && it.error( ) == Error::InvalidWord && broken.check( ).code == Error::InvalidWord );
+    // codec settings instead of thread ones
+    Codec const ukrainian{ Language::Ukrainian, Validate::None };
+    SON8_CHECK( view_equal( EncodeView{ ukrainian, u"Ї" }, StringByteView{ "JI" } ) );
+    SON8_CHECK( view_equal( DecodeView{ ukrainian, "JI" }, StringWordView{ u"Ї" } ) );
+    // lazy probes of hash containers keyed by materialized output
+    this_thread::state( Language::Russian );
+    this_thread::state( Validate::AppendAll );
+    std::unordered_map< StringByte, int, ViewHash, ViewEqual > ids;
+    std::unordered_set< StringByte, ViewHash, ViewEqual > keys;
+    std::vector< StringWord > texts;
+    for ( int index = 0; index < 200; ++index ) {
+        texts.push_back( random.words( Pool_Letters_, 1 + random.below( 90 ) ) );
+        auto key = encode( texts.back( ) ).ref( );
+        keys.insert( key );
+        ids.emplace( std::move( key ), index );
+    }
+    for ( int index = 0; index < 200; ++index ) {
+        auto const found = view_find( ids, EncodeView{ texts[index] } );
+        SON8_CHECK( found != ids.end( ) && found == ids.find( encode( texts[index] ).ref( ) ) );
+        SON8_CHECK( view_find( keys, EncodeView{ texts[index] } ) != keys.end( ) );
+        auto const missing = texts[index] + u"Ъ!Ъ";
+        SON8_CHECK( view_find( ids, EncodeView{ missing } ) == ids.end( ) && view_find( keys, EncodeView{ missing } ) == keys.end( ) );
+    }
+    auto const &constant = ids;
+    SON8_CHECK( view_find( constant, StringByteView{ "nothing" } ) == constant.end( ) );
+    std::unordered_set< StringByte, ViewHash, ViewEqual > empty;
+    SON8_CHECK( view_find( empty, StringByteView{ "" } ) == empty.end( ) );
+    return finish( );
+}
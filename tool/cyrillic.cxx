@@ -0,0 +1,253 @@
+#include <son8/cyrillic.hxx>
+// std headers
+#include <cerrno> // errno
+#include <cstdio> // fopen, fread, fwrite, fprintf
+#include <cstdlib> // strtoull, EXIT_*
+#include <cstring> // strcmp, strerror
+#include <string> // string
+#include <string_view> // string_view
+#include <utility> // pair
+// platform headers, files are memory-mapped where available
+#if __has_include( <sys/mman.h> )
+#define SON8_CYRILLIC_TOOL_MMAP
+#include <fcntl.h> // open
+#include <sys/mman.h> // mmap, madvise, munmap
+#include <sys/stat.h> // fstat
+#include <unistd.h> // close
+#endif
+
+namespace cyr = son8::cyrillic;
+
+namespace {
+    enum class Exit : int {
+        Success = 0,
+        Invalid = 1, // input rejected by encode or decode
+        Failure = 2, // bad arguments or io error
+    };
+    struct Options {
+        bool decode{ false };
+        cyr::Language language{ cyr::Language::Russian };
+        cyr::Validate validate{ cyr::Validate::None };
+        unsigned threads{ 1 };
+        cyr::Size window{ cyr::Size{ 16 } << 20 };
+        char const *input{ "-" };
+        char const *output{ "-" };
+    };
+    void usage( ) {
+        std::fprintf( stderr,
+            "usage: cyrillic encode|decode [options] [input [output]]\n"
+            "  input and output default to '-' (stdin and stdout), text is utf-8\n"
+            "  -l, --language ru|ua               default ru\n"
+            "  -v, --validate none|ignore|append|0xMASK  encode only, default none\n"
+            "  -t, --threads N                    workers per window, 0 for hardware concurrency\n"
+            "  -w, --window MIB                   window size in MiB, default 16\n" );
+    }
+    auto parse_language( std::string_view arg, cyr::Language &language ) -> bool {
+        if/*_*/ ( arg == "ru" ) language = cyr::Language::Russian;
+        else if ( arg == "ua" ) language = cyr::Language::Ukrainian;
+        else return false;
+        return true;
+    }
+    auto parse_validate( char const *arg, cyr::Validate &validate ) -> bool {
+        std::string_view const name{ arg };
+        if/*_*/ ( name == "none" ) validate = cyr::Validate::None;
+        else if ( name == "ignore" ) validate = cyr::Validate::IgnoreAll;
+        else if ( name == "append" ) validate = cyr::Validate::AppendAll;
+        else {
+            char *end = nullptr;
+            errno = 0;
+            auto const mask = std::strtoull( arg, &end, 16 );
+            if ( errno != 0 || end == arg || *end != '\0' ) return false;
+            validate = static_cast< cyr::Validate >( mask );
+        }
+        return true;
+    }
+    auto parse_number( char const *arg, unsigned long long &number ) -> bool {
+        char *end = nullptr;
+        errno = 0;
+        number = std::strtoull( arg, &end, 10 );
+        return errno == 0 && end != arg && *end == '\0';
+    }
+    auto parse( int argc, char **argv, Options &options ) -> bool {
+        if ( argc < 2 ) return false;
+        std::string_view const mode{ argv[1] };
+        if/*_*/ ( mode == "encode" ) options.decode = false;
+        else if ( mode == "decode" ) options.decode = true;
+        else return false;
+        int positional = 0;
+        for ( int i = 2; i < argc; ++i ) {
+            std::string_view const arg{ argv[i] };
+            auto const option = [&]( char const *brief, char const *name ) { return ( arg == brief || arg == name ) && i + 1 < argc; };
+            unsigned long long number = 0;
+            if/*_*/ ( option( "-l", "--language" ) ) { if ( not parse_language( argv[++i], options.language ) ) return false; }
+            else if ( option( "-v", "--validate" ) ) { if ( not parse_validate( argv[++i], options.validate ) ) return false; }
+            else if ( option( "-t", "--threads" ) ) {
+                if ( not parse_number( argv[++i], number ) ) return false;
+                options.threads = static_cast< unsigned >( number );
+            }
+            else if ( option( "-w", "--window" ) ) {
+                if ( not parse_number( argv[++i], number ) || number == 0 ) return false;
+                options.window = static_cast< cyr::Size >( number ) << 20;
+            }
+            else if ( arg.size( ) > 1 && arg.front( ) == '-' ) return false;
+            else if ( positional == 0 ) options.input = argv[i], ++positional;
+            else if ( positional == 1 ) options.output = argv[i], ++positional;
+            else return false;
+        }
+        return true;
+    }
+    // -- window end moved back so no utf-8 sequence or j/jx prefix is split, zero when no safe cut found
+    auto window_cut( std::string_view data, bool decode ) -> cyr::Size {
+        auto cut = data.size( );
+        if ( decode ) {
+            auto const prefix = []( char byte ) { return byte == 'j' || byte == 'J'; };
+            auto const prefix_x = [&]( cyr::Size at ) { return at >= 2 && ( data[at - 1] == 'x' || data[at - 1] == 'X' ) && prefix( data[at - 2] ); };
+            while ( cut > 0 && ( prefix( data[cut - 1] ) || prefix_x( cut ) ) ) --cut;
+        } else {
+            // -- last sequence may be incomplete, cut before its lead byte
+            while ( cut > 0 && data.size( ) - cut < 4 ) {
+                if ( ( static_cast< unsigned char >( data[--cut] ) & 0xC0u ) != 0x80u ) break;
+            }
+        }
+        return cut;
+    }
+    class Writer {
+        std::FILE *file_;
+        bool owned_;
+    public:
+        explicit Writer( char const *path )
+            : file_{ std::strcmp( path, "-" ) == 0 ? stdout : std::fopen( path, "wb" ) }
+            , owned_{ file_ != stdout } { }
+       ~Writer( ) { if ( owned_ && file_ ) std::fclose( file_ ); }
+        Writer( Writer const & ) = delete;
+        Writer &operator=( Writer const & ) = delete;
+        explicit operator bool( ) const noexcept { return file_ != nullptr; }
+        // -- whole window written with single call, stdio buffer is bypassed for large sizes
+        auto write( std::string_view data ) -> bool { return std::fwrite( data.data( ), 1, data.size( ), file_ ) == data.size( ); }
+        auto flush( ) -> bool { return std::fflush( file_ ) == 0; }
+    };
+    class Engine {
+        Options const &options_;
+        Writer &writer_;
+        std::string out_;
+        cyr::Size offset_{ 0 }; // input bytes consumed by previous windows
+    public:
+        Engine( Options const &options, Writer &writer ) : options_{ options }, writer_{ writer } {
+            cyr::this_thread::state( options.language );
+            cyr::this_thread::state( options.validate );
+        }
+        // -- transliterates whole window, reports input offset of first failure
+        auto window( std::string_view data ) -> Exit {
+            cyr::Parallel const parallel{ options_.threads, options_.window / 16 };
+            auto const code = options_.decode
+                ? cyr::decode( out_, data, parallel )
+                : cyr::encode( out_, data, parallel );
+            if ( code != cyr::Error::None ) {
+                auto const result = options_.decode ? cyr::decoded_size( data ) : cyr::encoded_size( data );
+                std::fprintf( stderr, "cyrillic: %s at byte %zu\n", cyr::error_message( code ), offset_ + result.read );
+                return Exit::Invalid;
+            }
+            offset_ += data.size( );
+            if ( not writer_.write( out_ ) ) {
+                std::fprintf( stderr, "cyrillic: write failed: %s\n", std::strerror( errno ) );
+                return Exit::Failure;
+            }
+            return Exit::Success;
+        }
+        // -- windows of mapped or buffered input, unfinished tail goes to next window
+        auto run( std::string_view data, bool last ) -> std::pair< Exit, cyr::Size > {
+            cyr::Size done = 0;
+            while ( data.size( ) - done >= options_.window || ( last && done < data.size( ) ) ) {
+                auto view = data.substr( done, options_.window );
+                bool const final = last && done + view.size( ) == data.size( );
+                if ( not final ) view = view.substr( 0, window_cut( view, options_.decode ) );
+                if ( view.empty( ) ) view = data.substr( done ); // window without safe cut, take everything left
+                if ( auto const exit = window( view ); exit != Exit::Success ) return { exit, done };
+                done += view.size( );
+            }
+            return { Exit::Success, done };
+        }
+    };
+    auto stream( std::FILE *file, Engine &engine, cyr::Size window ) -> Exit {
+        std::string buffer;
+        cyr::Size used = 0;
+        for ( ;; ) {
+            buffer.resize( used + window );
+            auto const read = std::fread( buffer.data( ) + used, 1, window, file );
+            used += read;
+            bool const last = read < window;
+            if ( last && std::ferror( file ) ) {
+                std::fprintf( stderr, "cyrillic: read failed: %s\n", std::strerror( errno ) );
+                return Exit::Failure;
+            }
+            auto const [exit,done] = engine.run( std::string_view{ buffer.data( ), used }, last );
+            if ( exit != Exit::Success || last ) return exit;
+            buffer.erase( 0, done );
+            used -= done;
+        }
+    }
+#ifdef SON8_CYRILLIC_TOOL_MMAP
+    // -- whole file mapped once, kernel reads ahead for sequential window access
+    auto mapped( char const *path, Engine &engine ) -> Exit {
+        auto const fd = ::open( path, O_RDONLY );
+        if ( fd < 0 ) {
+            std::fprintf( stderr, "cyrillic: cannot open %s: %s\n", path, std::strerror( errno ) );
+            return Exit::Failure;
+        }
+        struct stat info{ };
+        if ( ::fstat( fd, &info ) != 0 || not S_ISREG( info.st_mode ) ) {
+            ::close( fd );
+            auto *file = std::fopen( path, "rb" );
+            if ( file == nullptr ) return Exit::Failure;
+            auto const exit = stream( file, engine, cyr::Size{ 16 } << 20 );
+            std::fclose( file );
+            return exit;
+        }
+        auto const size = static_cast< cyr::Size >( info.st_size );
+        if ( size == 0 ) {
+            ::close( fd );
+            return Exit::Success;
+        }
+        auto *data = ::mmap( nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0 );
+        ::close( fd );
+        if ( data == MAP_FAILED ) {
+            std::fprintf( stderr, "cyrillic: cannot map %s: %s\n", path, std::strerror( errno ) );
+            return Exit::Failure;
+        }
+        ::madvise( data, size, MADV_SEQUENTIAL );
+        auto const exit = engine.run( std::string_view{ static_cast< char const * >( data ), size }, true ).first;
+        ::munmap( data, size );
+        return exit;
+    }
+#endif
+} // namespace
+
+int main( int argc, char **argv ) {
+    Options options;
+    if ( not parse( argc, argv, options ) ) return usage( ), static_cast< int >( Exit::Failure );
+    Writer writer{ options.output };
+    if ( not writer ) {
+        std::fprintf( stderr, "cyrillic: cannot open %s: %s\n", options.output, std::strerror( errno ) );
+        return static_cast< int >( Exit::Failure );
+    }
+    Engine engine{ options, writer };
+    Exit exit;
+    if ( std::strcmp( options.input, "-" ) == 0 ) exit = stream( stdin, engine, options.window );
+    else {
+#ifdef SON8_CYRILLIC_TOOL_MMAP
+        exit = mapped( options.input, engine );
+#else
+        auto *file = std::fopen( options.input, "rb" );
+        if ( file == nullptr ) {
+            std::fprintf( stderr, "cyrillic: cannot open %s: %s\n", options.input, std::strerror( errno ) );
+            return static_cast< int >( Exit::Failure );
+        }
+        exit = stream( file, engine, options.window );
+        std::fclose( file );
+#endif
+    }
+    if ( not writer.flush( ) && exit == Exit::Success ) exit = Exit::Failure;
+    return static_cast< int >( exit );
+}
+
+// Ⓒ 2026 Oleg'Ease'Kharchuk ᦒ